@@ -64,6 +64,13 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
 }
 
 
+void ZipOutputStream::putRawEntry( const std::string &entryName, const char *data,
+                                   uint32 compressed_size, uint32 crc, uint32 size,
+                                   StorageMethod method ) {
+  ozf->putRawEntry( ZipCDirEntry( entryName ), data, compressed_size, crc, size, method ) ;
+}
+
+
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
 }
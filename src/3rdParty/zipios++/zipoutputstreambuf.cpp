@@ -23,7 +23,8 @@ ZipOutputStreambuf::ZipOutputStreambuf( streambuf *outbuf, bool del_outbuf )
     _open_entry( false    ),
     _open      ( true     ),
     _method    ( DEFLATED ),
-    _level     ( 6        )
+    _level     ( 6        ),
+    _store_entry( false   )
 {
 }
 
@@ -32,7 +33,10 @@ void ZipOutputStreambuf::closeEntry() {
   if ( ! _open_entry )
     return ;
 
-  closeStream() ;
+  if ( _store_entry )
+    overflow() ;
+  else
+    closeStream() ;
 
   updateEntryHeaderInfo() ;
   setEntryClosedState( ) ;
@@ -63,7 +67,13 @@ void ZipOutputStreambuf::putNextEntry( const ZipCDirEntry &entry ) {
   if ( _open_entry )
     closeEntry() ;
 
-  if ( ! init( _level ) )
+  _store_entry = ( _method == STORED ) ;
+  if ( _store_entry ) {
+    // no deflation, overflow() copies the data to _outbuf
+    setp( &( _invec[ 0 ] ), &( _invec[ 0 ] ) + _invecsize ) ;
+    _crc32 = crc32( 0, Z_NULL, 0 ) ;
+    _overflown_bytes = 0 ;
+  } else if ( ! init( _level ) )
     cerr << "ZipOutputStreambuf::putNextEntry(): init() failed!\n" ;
 
   _entries.push_back( entry ) ;
@@ -81,6 +91,29 @@ void ZipOutputStreambuf::putNextEntry( const ZipCDirEntry &entry ) {
 }
 
 
+void ZipOutputStreambuf::putRawEntry( const ZipCDirEntry &entry, const char *data,
+                                      uint32 compressed_size, uint32 crc, uint32 size,
+                                      StorageMethod method ) {
+  if ( _open_entry )
+    closeEntry() ;
+
+  _entries.push_back( entry ) ;
+  ZipCDirEntry &ent = _entries.back() ;
+
+  ostream os( _outbuf ) ;
+
+  ent.setLocalHeaderOffset( os.tellp() ) ;
+  ent.setMethod( method ) ;
+  ent.setSize( size ) ;
+  ent.setCrc( crc ) ;
+  ent.setCompressedSize( compressed_size ) ;
+  ent.setTime( currentDosTime() ) ;
+
+  os << static_cast< ZipLocalEntry >( ent ) ;
+  os.write( data, compressed_size ) ;
+}
+
+
 void ZipOutputStreambuf::setComment( const string &comment ) {
   _zip_comment = comment ;
 }
@@ -107,6 +140,23 @@ void ZipOutputStreambuf::setMethod( StorageMethod method ) {
 //
 
 int ZipOutputStreambuf::overflow( int c ) {
+  if ( _store_entry ) {
+    int len = pptr() - pbase() ;
+    _crc32 = crc32( _crc32, reinterpret_cast< unsigned char * >( pbase() ), len ) ;
+    _overflown_bytes += len ;
+
+    if ( _outbuf->sputn( pbase(), len ) != len ) {
+      cerr << "ZipOutputStreambuf::overflow(): writing stored data failed\n" ;
+      return EOF ;
+    }
+    setp( &( _invec[ 0 ] ), &( _invec[ 0 ] ) + _invecsize ) ;
+
+    if ( c != EOF ) {
+      *pptr() = c ;
+      pbump( 1 ) ;
+    }
+    return 0 ;
+  }
   return DeflateOutputStreambuf::overflow( c ) ;
 //    // FIXME: implement
   
@@ -127,6 +177,7 @@ int ZipOutputStreambuf::sync() {
 
 void ZipOutputStreambuf::setEntryClosedState() {
   _open_entry = false ;
+  _store_entry = false ;
   // FIXME: update put pointers to trigger overflow on write. overflow
   // should then return EOF while _open_entry is false.
 }
@@ -147,13 +198,7 @@ void ZipOutputStreambuf::updateEntryHeaderInfo() {
 			   - entry.getLocalHeaderSize() ) ;
 
   // Mark Donszelmann: added current date and time
-  time_t ltime;
-  time( &ltime );
-  struct tm *now;
-  now = localtime( &ltime );
-  int dosTime = (now->tm_year - 80) << 25 | (now->tm_mon + 1) << 21 | now->tm_mday << 16 |
-              now->tm_hour << 11 | now->tm_min << 5 | now->tm_sec >> 1;
-  entry.setTime(dosTime);
+  entry.setTime( currentDosTime() ) ;
 
   // write ZipLocalEntry header to header position
   os.seekp( entry.getLocalHeaderOffset() ) ;
@@ -162,6 +207,16 @@ void ZipOutputStreambuf::updateEntryHeaderInfo() {
 }
 
 
+int ZipOutputStreambuf::currentDosTime() {
+  time_t ltime;
+  time( &ltime );
+  struct tm *now;
+  now = localtime( &ltime );
+  return (now->tm_year - 80) << 25 | (now->tm_mon + 1) << 21 | now->tm_mday << 16 |
+         now->tm_hour << 11 | now->tm_min << 5 | now->tm_sec >> 1;
+}
+
+
 void ZipOutputStreambuf::writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
 						EndOfCentralDirectory eocd, 
 						ostream &os ) {
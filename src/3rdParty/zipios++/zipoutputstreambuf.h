@@ -49,6 +49,20 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes a complete entry whose data has already been deflated
+      (raw deflate stream without zlib header) or is stored
+      uncompressed, depending on the given method. Any open entry is
+      closed first. The entry is written in one go, so the underlying
+      stream doesn't have to be seekable.
+      @param entry the entry to write.
+      @param data the compressed data.
+      @param compressed_size the number of bytes in data.
+      @param crc the CRC32 of the uncompressed data.
+      @param size the size of the uncompressed data.
+      @param method the storage method of data. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 compressed_size,
+                    uint32 crc, uint32 size, StorageMethod method = DEFLATED ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -56,7 +70,8 @@ public:
   void setLevel( int level ) ;
 
   /** Sets the compression method to be used. only STORED and DEFLATED are
-      supported. */
+      supported. The data of STORED entries is copied to the output as
+      it is written, without running it through zlib. */
   void setMethod( StorageMethod method ) ;
 
   /** Destructor. */
@@ -69,6 +84,9 @@ protected:
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
 
+  /** Returns the current local time in MS-DOS format. */
+  static int currentDosTime() ;
+
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
 				     EndOfCentralDirectory eocd,
@@ -83,6 +101,7 @@ private:
   bool _open ;
   StorageMethod _method ;
   int _level ;
+  bool _store_entry ;
 };
 
 
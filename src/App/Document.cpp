@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <bitset>
+#include <cstring>
 #include <stack>
 #include <boost/filesystem.hpp>
 #include <deque>
@@ -36,7 +37,12 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
 #endif
 
 #include <boost/algorithm/string.hpp>
@@ -807,8 +813,18 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
+    std::unique_lock<std::recursive_mutex> lock(d->recomputeMutex, std::defer_lock);
+    if (d->concurrentRecompute) {
+        lock.lock();
+    }
     if (Who->isDerivedFrom<App::DocumentObject>()) {
-        signalBeforeChangeObject(*static_cast<const App::DocumentObject*>(Who), *What);
+        auto obj = static_cast<const App::DocumentObject*>(Who);
+        if (d->concurrentRecompute) {
+            d->deferredSignals.push_back({DocumentP::DeferredSignal::BeforeChange, obj, What});
+        }
+        else {
+            signalBeforeChangeObject(*obj, *What);
+        }
     }
     if (!d->rollback && !globalIsRelabeling) {
         _checkTransaction(nullptr, What, __LINE__);
@@ -820,9 +836,52 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    std::unique_lock<std::recursive_mutex> lock(d->recomputeMutex, std::defer_lock);
+    if (d->concurrentRecompute) {
+        lock.lock();
+        d->deferredSignals.push_back({DocumentP::DeferredSignal::Changed, Who, What});
+        return;
+    }
     signalChangedObject(*Who, *What);
 }
 
+void Document::onTouchedObject(const DocumentObject* Who)
+{
+    std::unique_lock<std::recursive_mutex> lock(d->recomputeMutex, std::defer_lock);
+    if (d->concurrentRecompute) {
+        lock.lock();
+        d->deferredSignals.push_back({DocumentP::DeferredSignal::Touched, Who, nullptr});
+        return;
+    }
+    signalTouchedObject(*Who);
+}
+
+void Document::_emitDeferredSignals()
+{
+    std::vector<DocumentP::DeferredSignal> signals;
+    signals.swap(d->deferredSignals);
+    for (const auto& sig : signals) {
+        switch (sig.kind) {
+            case DocumentP::DeferredSignal::BeforeChange:
+                signalBeforeChangeObject(*sig.obj, *sig.prop);
+                const_cast<DocumentObject*>(sig.obj)->signalBeforeChange(*sig.obj, *sig.prop);
+                break;
+            case DocumentP::DeferredSignal::Changed:
+                signalChangedObject(*sig.obj, *sig.prop);
+                const_cast<DocumentObject*>(sig.obj)->signalChanged(*sig.obj, *sig.prop);
+                break;
+            case DocumentP::DeferredSignal::Touched:
+                signalTouchedObject(*sig.obj);
+                break;
+        }
+    }
+}
+
+bool Document::_isDeferringSignals() const
+{
+    return d->concurrentRecompute;
+}
+
 void Document::setTransactionMode(int iMode)
 {
     d->iTransactionMode = iMode;
@@ -2160,6 +2219,13 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        // number of threads used to compress the additional files, 0 means
+        // one per hardware thread
+        int threads = static_cast<int>(hGrp->GetInt("SaveThreads", 1));
+        if (threads <= 0) {
+            threads = static_cast<int>(std::thread::hardware_concurrency());
+        }
+        writer.setThreads(threads);
         writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
@@ -2337,7 +2403,22 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
-    reader.readFiles(zipstream);
+
+    // With more than one thread the data files are read by random access
+    // using the central directory of the zip file, 0 means one thread per
+    // hardware thread
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    int threads = static_cast<int>(hGrp->GetInt("RestoreThreads", 1));
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    if (threads > 1) {
+        reader.readFiles(fi.filePath(), threads);
+    }
+    else {
+        reader.readFiles(zipstream);
+    }
 
     DocumentP::checkStringHasher(reader);
 
@@ -2937,6 +3018,95 @@ void Document::renameObjectIdentifiers(
     }
 }
 
+// Assign each object of a dependency sorted list a level, i.e. the length of the
+// longest dependency chain leading to it inside the list, and stable sort the
+// list by it. Objects of the same level do not depend on each other. Within a
+// level, objects that can be recomputed concurrently are moved to the front.
+// Return false and leave the list untouched if it is not in dependency order.
+static bool _levelDependencyList(std::vector<App::DocumentObject*>& objs,
+                                 std::unordered_map<App::DocumentObject*, int>& levels)
+{
+    std::unordered_set<App::DocumentObject*> objSet(objs.begin(), objs.end());
+    levels.clear();
+    for (auto obj : objs) {
+        int level = 0;
+        for (auto dep : obj->getOutList()) {
+            if (dep == obj || objSet.find(dep) == objSet.end()) {
+                continue;
+            }
+            auto it = levels.find(dep);
+            if (it == levels.end()) {
+                // cyclic dependency or dependency inversion
+                levels.clear();
+                return false;
+            }
+            level = std::max(level, it->second + 1);
+        }
+        levels[obj] = level;
+    }
+
+    std::unordered_set<App::DocumentObject*> concurrent;
+    for (auto obj : objs) {
+        if (obj->canRecomputeConcurrently()) {
+            concurrent.insert(obj);
+        }
+    }
+    std::stable_sort(objs.begin(),
+                     objs.end(),
+                     [&](App::DocumentObject* a, App::DocumentObject* b) {
+                         int la = levels[a];
+                         int lb = levels[b];
+                         if (la != lb) {
+                             return la < lb;
+                         }
+                         return concurrent.count(a) > concurrent.count(b);
+                     });
+    return true;
+}
+
+// Call func for each object using up to the given number of threads. Idle
+// threads pick the next pending object so that expensive objects don't stall
+// the others.
+static std::vector<int> _runConcurrently(const std::vector<App::DocumentObject*>& objs,
+                                         int threads,
+                                         const std::function<int(App::DocumentObject*)>& func)
+{
+    std::vector<int> results(objs.size(), 0);
+    std::atomic<size_t> next {0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < objs.size(); i = next++) {
+            results[i] = func(objs[i]);
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    int count = std::min(threads, static_cast<int>(objs.size()));
+    for (int i = 1; i < count; ++i) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    std::exception_ptr error;
+    try {
+        worker();
+    }
+    catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& future : futures) {
+        try {
+            future.get();
+        }
+        catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return results;
+}
+
 int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                         bool force,
                         bool* hasError,
@@ -3009,9 +3179,71 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
 
+    // Parallel recompute is opt-in. Independent objects that declare
+    // themselves thread safe are recomputed concurrently, everything else
+    // keeps going through the serial loop below.
+    int threads = 0;
+    if (hGrp->GetBool("ParallelRecompute", false)) {
+        threads = static_cast<int>(hGrp->GetInt("RecomputeThreads", 0));
+        if (threads <= 0) {
+            threads = static_cast<int>(std::thread::hardware_concurrency());
+        }
+    }
+    std::unordered_map<App::DocumentObject*, int> levels;
+    if (threads > 1 && !_levelDependencyList(topoSortedObjects, levels)) {
+        FC_LOG("Dependency list not leveled, fall back to serial recompute");
+        threads = 0;
+    }
+
     std::set<App::DocumentObject*> filter;
     size_t idx = 0;
 
+    // results of objects that have been recomputed concurrently ahead of the
+    // serial loop
+    std::unordered_map<App::DocumentObject*, int> concurrentResults;
+    size_t batchEnd = 0;
+    auto recomputeBatch = [&]() {
+        int level = levels[topoSortedObjects[idx]];
+        std::vector<App::DocumentObject*> batch;
+        for (batchEnd = idx; batchEnd < topoSortedObjects.size(); ++batchEnd) {
+            auto obj = topoSortedObjects[batchEnd];
+            if (levels[obj] != level || !obj->canRecomputeConcurrently()) {
+                break;
+            }
+            // expressions may call into Python, leave those to the serial loop
+            if (obj->isAttachedToDocument() && filter.find(obj) == filter.end()
+                && obj->ExpressionEngine.numExpressions() == 0 && obj->mustRecompute()) {
+                batch.push_back(obj);
+            }
+        }
+        if (batch.size() < 2) {
+            return;
+        }
+
+        FC_LOG("Recompute " << batch.size() << " objects concurrently");
+        std::vector<int> results;
+        std::exception_ptr error;
+        {
+            Base::StateLocker guard(d->concurrentRecompute);
+            try {
+                results = _runConcurrently(batch, threads, [this](App::DocumentObject* obj) {
+                    return _recomputeFeature(obj);
+                });
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        }
+        // the object signals reach the GUI, so they are only emitted from this thread
+        _emitDeferredSignals();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        for (size_t i = 0; i < batch.size(); ++i) {
+            concurrentResults[batch[i]] = results[i];
+        }
+    };
+
     FC_TIME_INIT(t2);
 
     try {
@@ -3028,12 +3260,23 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
                     continue;
                 }
+                if (threads > 1 && idx >= batchEnd && obj->canRecomputeConcurrently()) {
+                    recomputeBatch();
+                }
+                auto itResult = concurrentResults.find(obj);
                 // ask the object if it should be recomputed
                 bool doRecompute = false;
-                if (obj->mustRecompute()) {
+                if (itResult != concurrentResults.end() || obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
-                    int res = _recomputeFeature(obj);
+                    int res = 0;
+                    if (itResult != concurrentResults.end()) {
+                        res = itResult->second;
+                        concurrentResults.erase(itResult);
+                    }
+                    else {
+                        res = _recomputeFeature(obj);
+                    }
                     if (res) {
                         if (hasError) {
                             *hasError = true;
@@ -3317,8 +3560,25 @@ const char* Document::getErrorDescription(const App::DocumentObject* Obj) const
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat)
 {
+    ZoneScoped;
     FC_LOG("Recomputing " << Feat->getFullName());
 
+#ifdef TRACY_ENABLE
+    const char* typeName = Feat->getTypeId().getName();
+    ZoneName(typeName, std::strlen(typeName));
+
+    // per feature type plot of the recompute time in milliseconds
+    struct RecomputePlot
+    {
+        const char* name;
+        Base::TimeElapsed start;
+        ~RecomputePlot()
+        {
+            TracyPlot(name, 1000.0 * Base::TimeElapsed::diffTimeF(start, Base::TimeElapsed()));
+        }
+    } recomputePlot {typeName, Base::TimeElapsed()};
+#endif
+
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
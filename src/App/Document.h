@@ -638,6 +638,12 @@ protected:
     void onBeforeChangeProperty(const TransactionalObject* Who, const Property* What);
     /// callback from the Document objects after property was changed
     void onChangedProperty(const DocumentObject* Who, const Property* What);
+    /// callback from the Document objects after they were touched
+    void onTouchedObject(const DocumentObject* Who);
+    /// emit the signals deferred while objects were recomputed concurrently
+    void _emitDeferredSignals();
+    /// returns true while the property change signals of the objects are deferred
+    bool _isDeferringSignals() const;
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
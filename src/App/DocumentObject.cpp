@@ -220,7 +220,7 @@ void DocumentObject::touch(bool noRecompute)
     }
     StatusBits.set(ObjectStatus::Touch);
     if (_pDoc) {
-        _pDoc->signalTouchedObject(*this);
+        _pDoc->onTouchedObject(this);
     }
 }
 
@@ -740,6 +740,11 @@ void DocumentObject::onBeforeChange(const Property* prop)
 
     if (_pDoc){
         onBeforeChangeProperty(_pDoc, prop);
+        // the slots may change other objects, so while recomputing concurrently
+        // the document emits the signal once the batch is done
+        if (_pDoc->_isDeferringSignals()) {
+            return;
+        }
     }
 
     signalBeforeChange(*this, *prop);
@@ -881,6 +886,10 @@ void DocumentObject::onChanged(const Property* prop)
     // Now signal the view provider
     if (_pDoc) {
         _pDoc->onChangedProperty(this, prop);
+        // emitted together with the deferred document signal, see onBeforeChange()
+        if (_pDoc->_isDeferringSignals()) {
+            return;
+        }
     }
 
     signalChanged(*this, *prop);
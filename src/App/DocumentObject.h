@@ -517,6 +517,18 @@ public:
     {
         return false;
     }
+
+    /** Return true if this object can be recomputed concurrently
+     *
+     * It is used by Document::recompute() when parallel recompute is enabled.
+     * Only objects whose execute() does not call into Python and only modifies
+     * its own properties may return true. Objects returning false are always
+     * recomputed serially.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return false;
+    }
     /// Handle Label changes, including forcing unique label values,
     /// signalling OnBeforeLabelChange, and arranging to update linked references,
     /// on the assumption that after returning the label will indeed be changed to
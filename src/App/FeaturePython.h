@@ -334,6 +334,12 @@ public:
         return FeatureT::canLoadPartial();
     }
 
+    bool canRecomputeConcurrently() const override
+    {
+        // execute() may call into Python
+        return false;
+    }
+
     /**
      * @brief Called when a property is edited by the user.
      *
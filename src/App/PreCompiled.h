@@ -68,20 +68,25 @@
 #include <sstream>
 
 // STL
+#include <atomic>
 #include <bitset>
 #include <chrono>
+#include <cstring>
 #include <exception>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <random>
 #include <set>
 #include <stack>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -30,6 +30,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -95,6 +96,23 @@ struct DocumentP
     mutable HasherMap hashers;
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
+    // serializes document side effects while objects are recomputed concurrently
+    std::recursive_mutex recomputeMutex;
+    bool concurrentRecompute {false};
+    // document and object signals raised by concurrently recomputed objects, emitted later
+    // by the recomputing thread because their slots may touch the GUI or other objects
+    struct DeferredSignal
+    {
+        enum Kind
+        {
+            BeforeChange,
+            Changed,
+            Touched
+        } kind;
+        const App::DocumentObject* obj;
+        const App::Property* prop;
+    };
+    std::vector<DeferredSignal> deferredSignals;
 
     StringHasherRef Hasher;
 
@@ -116,6 +134,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::recursive_mutex> lock(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
@@ -145,6 +145,24 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** Return true if the data file can be read on a worker thread
+     * If true, XMLReader::readFiles() may call readDocFile() from a worker
+     * thread followed by finishRestoreDocFile() from the restoring thread,
+     * instead of RestoreDocFile(). readDocFile() must only parse the data
+     * into a private state of this object. Everything else, e.g. notifying
+     * the container, must be left to finishRestoreDocFile() which is called
+     * in the order the files were registered.
+     */
+    virtual bool canRestoreDocFileConcurrently() const
+    {
+        return false;
+    }
+    /// Read the data file without side effects, see canRestoreDocFileConcurrently()
+    virtual void readDocFile(Reader& /*reader*/)
+    {}
+    /// Apply the data read by readDocFile()
+    virtual void finishRestoreDocFile()
+    {}
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
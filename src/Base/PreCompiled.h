@@ -60,7 +60,10 @@
 
 // STL
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <deque>
+#include <future>
 #include <iomanip>
 #include <list>
 #include <limits>
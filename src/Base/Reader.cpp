@@ -24,6 +24,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <atomic>
+#include <future>
 #include <map>
 #include <vector>
 #include <iostream>
@@ -41,6 +43,7 @@
 #include "Exception.h"
 #include "InputSource.h"
 #include "Persistence.h"
+#include "Profiler.h"
 #include "Sequencer.h"
 #include "Stream.h"
 #include "XMLTools.h"
@@ -48,6 +51,7 @@
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -398,6 +402,8 @@ void Base::XMLReader::readBinFile(const char* filename)
 
 void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
 {
+    ZoneScoped;
+
     // It's possible that not all objects inside the document could be created, e.g. if a module
     // is missing that would know these object types. So, there may be data files inside the zip
     // file that cannot be read. We simply ignore these files.
@@ -461,6 +467,96 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
     }
 }
 
+void Base::XMLReader::readFiles(const std::string& zipFileName, int threads) const
+{
+    ZoneScoped;
+
+    zipios::ZipFile zipfile(zipFileName);
+    if (!zipfile.isValid()) {
+        return;
+    }
+
+    struct Task
+    {
+        const FileEntry* file;
+        std::streampos offset;
+        bool concurrent;
+        std::promise<void> done;
+    };
+
+    // Look up all entries in this thread as the entry pointers of zipios are
+    // not thread safe. Files that are not part of the zip file are ignored,
+    // see the sequential readFiles() above.
+    std::vector<Task> tasks;
+    tasks.reserve(FileList.size());
+    std::vector<Task*> concurrentTasks;
+    for (const auto& file : FileList) {
+        zipios::ConstEntryPointer entry = zipfile.getEntry(file.FileName);
+        if (!entry || !entry->isValid()) {
+            continue;
+        }
+        auto cdirEntry = static_cast<const zipios::ZipCDirEntry*>(entry.get());
+        bool concurrent = threads > 1 && file.Object->canRestoreDocFileConcurrently();
+        tasks.push_back({&file, cdirEntry->getLocalHeaderOffset(), concurrent, {}});
+    }
+    for (auto& task : tasks) {
+        if (task.concurrent) {
+            concurrentTasks.push_back(&task);
+        }
+    }
+
+    int fileVersion = FileVersion;
+    std::atomic<size_t> next {0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < concurrentTasks.size(); i = next++) {
+            Task& task = *concurrentTasks[i];
+            try {
+                zipios::ZipInputStream zipstream(zipFileName, task.offset);
+                Base::Reader reader(zipstream, task.file->FileName, fileVersion);
+                task.file->Object->readDocFile(reader);
+                task.done.set_value();
+            }
+            catch (...) {
+                task.done.set_exception(std::current_exception());
+            }
+        }
+    };
+    std::vector<std::future<void>> workers;
+    if (!concurrentTasks.empty()) {
+        int count = std::min(threads, static_cast<int>(concurrentTasks.size()));
+        for (int i = 0; i < count; ++i) {
+            workers.push_back(std::async(std::launch::async, worker));
+        }
+    }
+
+    Base::SequencerLauncher seq("Importing project files...", tasks.size());
+    for (auto& task : tasks) {
+        const FileEntry& file = *task.file;
+        try {
+            if (task.concurrent) {
+                task.done.get_future().get();
+                file.Object->finishRestoreDocFile();
+            }
+            else {
+                zipios::ZipInputStream zipstream(zipFileName, task.offset);
+                Base::Reader reader(zipstream, file.FileName, FileVersion);
+                file.Object->RestoreDocFile(reader);
+                if (reader.getLocalReader()) {
+                    reader.getLocalReader()->readFiles(zipFileName, threads);
+                }
+            }
+        }
+        catch (...) {
+            // For any exception we just continue with the next file.
+            Base::Console().Error("Reading failed from embedded file: %s\n",
+                                  file.FileName.c_str());
+            FailedFiles.push_back(file.FileName);
+        }
+
+        seq.next();
+    }
+}
+
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
 {
     FileEntry temp;
@@ -251,6 +251,12 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Process the requested file writes using random access to the zip file
+     * Files of objects that can be restored concurrently are inflated and
+     * parsed by up to \a threads worker threads. All other files are read in
+     * order by the calling thread.
+     */
+    void readFiles(const std::string& zipFileName, int threads) const;
     /// Returns whether reader has any registered filenames
     bool hasFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -23,6 +23,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <deque>
+#include <future>
 #include <memory>
 #include <set>
 #include <vector>
@@ -39,11 +41,13 @@
 #include "Exception.h"
 #include "FileInfo.h"
 #include "Persistence.h"
+#include "Profiler.h"
 #include "Stream.h"
 #include "Tools.h"
 
 #include <boost/iostreams/filtering_stream.hpp>
 #include <zipios++/zipinputstream.h>
+#include <zlib.h>
 
 using namespace Base;
 
@@ -267,7 +271,7 @@ std::vector<std::string> Writer::getErrors() const
     return Errors;
 }
 
-std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
+std::string Writer::addFile(const char* Name, const Base::Persistence* Object, bool compress)
 {
     // always check isForceXML() before requesting a file!
     assert(!isForceXML());
@@ -278,6 +282,7 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
         temp.FileName = FileNameManager.makeUniqueName(temp.FileName);
     }
     temp.Object = Object;
+    temp.Compress = compress;
 
     FileList.push_back(temp);
     FileNameManager.addExactName(temp.FileName);
@@ -316,28 +321,83 @@ void Writer::putNextEntry(const char* file, const char* obj)
 
 // ----------------------------------------------------------------------------
 
-ZipWriter::ZipWriter(const char* FileName)
-    : ZipStream(FileName)
+namespace
+{
+void setupZipStream(std::ostream& str)
 {
 #ifdef _MSC_VER
-    ZipStream.imbue(std::locale::empty());
+    str.imbue(std::locale::empty());
 #else
-    ZipStream.imbue(std::locale::classic());
+    str.imbue(std::locale::classic());
 #endif
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    str.precision(std::numeric_limits<double>::digits10 + 1);
+    str.setf(std::ios::fixed, std::ios::floatfield);
+}
+
+struct DeflatedEntry
+{
+    std::string data;
+    uLong crc {};
+    uLong size {};
+};
+
+void putRawEntry(zipios::ZipOutputStream& zip, const std::string& fileName, const DeflatedEntry& entry)
+{
+    zip.putRawEntry(fileName,
+                    entry.data.data(),
+                    static_cast<zipios::uint32>(entry.data.size()),
+                    static_cast<zipios::uint32>(entry.crc),
+                    static_cast<zipios::uint32>(entry.size));
+}
+
+// Compress a whole entry the same way as zipios::DeflateOutputStreambuf does,
+// i.e. a raw deflate stream without zlib header.
+DeflatedEntry deflateEntry(const std::string& input, int level)
+{
+    if (input.size() > std::numeric_limits<uInt>::max()) {
+        throw Base::FileException("ZipWriter: entry too large");
+    }
+
+    DeflatedEntry entry;
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-type-const-cast)
+    auto in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    entry.size = static_cast<uLong>(input.size());
+    entry.crc = crc32(crc32(0, Z_NULL, 0), in, static_cast<uInt>(input.size()));
+
+    z_stream zs {};
+    const int memLevel = 8;
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, memLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("ZipWriter: failed to initialize deflate");
+    }
+    entry.data.resize(deflateBound(&zs, entry.size));
+    zs.next_in = in;
+    zs.avail_in = static_cast<uInt>(input.size());
+    zs.next_out = reinterpret_cast<Bytef*>(entry.data.data());
+    zs.avail_out = static_cast<uInt>(entry.data.size());
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-type-const-cast)
+
+    int err = deflate(&zs, Z_FINISH);
+    entry.data.resize(zs.total_out);
+    deflateEnd(&zs);
+    if (err != Z_STREAM_END) {
+        throw Base::RuntimeError("ZipWriter: deflate failed");
+    }
+    return entry;
+}
+}  // namespace
+
+ZipWriter::ZipWriter(const char* FileName)
+    : ZipStream(FileName)
+{
+    setupZipStream(ZipStream);
+    setupZipStream(EntryStream);
 }
 
 ZipWriter::ZipWriter(std::ostream& os)
     : ZipStream(os)
 {
-#ifdef _MSC_VER
-    ZipStream.imbue(std::locale::empty());
-#else
-    ZipStream.imbue(std::locale::classic());
-#endif
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    setupZipStream(ZipStream);
+    setupZipStream(EntryStream);
 }
 
 void ZipWriter::putNextEntry(const char* file, const char* obj)
@@ -351,17 +411,110 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
 
 void ZipWriter::writeFiles()
 {
+    ZoneScoped;
+
+    if (threads > 1) {
+        writeFilesParallel();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
     while (index < FileList.size()) {
         FileEntry entry = FileList[index];
-        putNextEntry(entry.FileName.c_str());
-        indent = 0;
-        indBuf[0] = 0;
+        if (entry.Compress) {
+            putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            entry.Object->SaveDocFile(*this);
+        }
+        else {
+            writeStoredEntry(entry);
+        }
+        index++;
+    }
+}
+
+void ZipWriter::writeStoredEntry(const FileEntry& entry)
+{
+    // The data goes straight to the archive, so even huge entries are
+    // never held in memory as a whole.
+    ZipStream.setMethod(zipios::STORED);
+    putNextEntry(entry.FileName.c_str());
+    ZipStream.setMethod(zipios::DEFLATED);
+    ZipStream.setLevel(compressionLevel);
+
+    indent = 0;
+    indBuf[0] = 0;
+    entry.Object->SaveDocFile(*this);
+}
+
+std::string ZipWriter::saveToBuffer(const FileEntry& entry)
+{
+    indent = 0;
+    indBuf[0] = 0;
+    EntryStream.str(std::string());
+    EntryStream.clear();
+    {
+        Base::StateLocker lock(bufferEntry);
         entry.Object->SaveDocFile(*this);
+    }
+    return std::move(EntryStream).str();
+}
+
+void ZipWriter::writeFilesParallel()
+{
+    ZoneScoped;
+
+    struct PendingEntry
+    {
+        std::string fileName;
+        std::future<DeflatedEntry> data;
+    };
+    std::deque<PendingEntry> pending;
+
+    auto writeFront = [this, &pending]() {
+        PendingEntry& front = pending.front();
+        putRawEntry(ZipStream, front.fileName, front.data.get());
+        pending.pop_front();
+        Writer::checkErrNo();
+    };
+
+    // at most one buffered entry per thread, to bound the memory usage
+    const size_t maxPending = static_cast<size_t>(threads);
+
+    // Serialization must happen in this thread because SaveDocFile() may
+    // add new files. Only the compression is done by the workers.
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+        if (!entry.Compress) {
+            // Nothing to offload, write it in place once the entries
+            // before it are in the archive.
+            while (!pending.empty()) {
+                writeFront();
+            }
+            writeStoredEntry(entry);
+            index++;
+            continue;
+        }
+
+        Writer::putNextEntry(entry.FileName.c_str());
+        pending.push_back({entry.FileName,
+                           std::async(std::launch::async,
+                                      deflateEntry,
+                                      saveToBuffer(entry),
+                                      compressionLevel)});
+        while (pending.size() >= maxPending) {
+            writeFront();
+        }
         index++;
     }
+
+    while (!pending.empty()) {
+        writeFront();
+    }
 }
 
 ZipWriter::~ZipWriter()
@@ -93,8 +93,11 @@ public:
 
     /** @name additional file writing */
     //@{
-    /// add a write request of a persistent object
-    std::string addFile(const char* Name, const Base::Persistence* Object);
+    /** add a write request of a persistent object
+     * If \a compress is false an archive stores the file without compression,
+     * this makes sense for large binary data that doesn't compress well.
+     */
+    std::string addFile(const char* Name, const Base::Persistence* Object, bool compress = true);
     /// process the requested file storing
     virtual void writeFiles() = 0;
     /// Set mode
@@ -167,6 +170,7 @@ protected:
     {
         std::string FileName;
         const Base::Persistence* Object;
+        bool Compress {true};
     };
     std::vector<FileEntry> FileList;
     UniqueFileNameManager FileNameManager;
@@ -209,6 +213,9 @@ public:
 
     std::ostream& Stream() override
     {
+        if (bufferEntry) {
+            return EntryStream;
+        }
         return ZipStream;
     }
 
@@ -219,6 +226,17 @@ public:
     void setLevel(int level)
     {
         ZipStream.setLevel(level);
+        compressionLevel = level;
+    }
+    /** Set the number of threads used by writeFiles()
+     * With more than one thread each additional file is serialized into its
+     * own buffer and deflated on a worker thread. The entries are still
+     * written to the archive in the order they were added. Uncompressed
+     * files are never buffered but written directly.
+     */
+    void setThreads(int num)
+    {
+        threads = num;
     }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
@@ -227,8 +245,17 @@ public:
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void writeFilesParallel();
+    void writeStoredEntry(const FileEntry& entry);
+    std::string saveToBuffer(const FileEntry& entry);
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::ostringstream EntryStream;
+    bool bufferEntry {false};
+    int compressionLevel {6};
+    int threads {1};
 };
 
 /** The StringWriter class
@@ -22,8 +22,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cinttypes>
-#include <iomanip>
 #include <boost/algorithm/string.hpp>
 #endif
 
@@ -94,49 +94,89 @@ bool Command::has(const std::string& attr) const
     return Parameters.count(a) > 0;
 }
 
-std::string Command::toGCode(int precision, bool padzero) const
+Command::Opcode Command::getOpcode(const std::string& name)
 {
-    std::stringstream str;
-    str.fill('0');
-    str << Name;
-    if (precision < 0) {
-        precision = 0;
+    if (name == "G0" || name == "G00") {
+        return Opcode::Rapid;
     }
-    double scale = std::pow(10.0, precision + 1);
-    std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin();
-         i != Parameters.end();
-         ++i) {
-        if (i->first == "N") {
-            continue;
-        }
+    if (name == "G1" || name == "G01") {
+        return Opcode::Linear;
+    }
+    if (name == "G2" || name == "G02") {
+        return Opcode::ArcCW;
+    }
+    if (name == "G3" || name == "G03") {
+        return Opcode::ArcCCW;
+    }
+    return Opcode::Other;
+}
 
-        str << " " << i->first;
+void Command::writeParameter(std::ostream& str,
+                             std::string_view key,
+                             double value,
+                             int precision,
+                             bool padzero)
+{
+    // the number is formatted backwards into a buffer, which is much faster than the stream
+    // operators when writing large paths
+    precision = std::clamp(precision, 0, 17);
+    std::int64_t iscale = 1;
+    for (int i = 0; i < precision; i++) {
+        iscale *= 10;
+    }
+    double scale = static_cast<double>(iscale) * 10.0;
 
-        std::int64_t v = static_cast<std::int64_t>(i->second * scale);
-        if (v < 0) {
-            v = -v;
-            str << '-';  // shall we allow -0 ?
-        }
-        v += 5;
-        v /= 10;
-        str << (v / iscale);
-        if (!precision) {
-            continue;
-        }
+    str.put(' ');
+    str.write(key.data(), static_cast<std::streamsize>(key.size()));
 
+    std::int64_t v = static_cast<std::int64_t>(value * scale);
+    bool negative = v < 0;  // shall we allow -0 ?
+    if (negative) {
+        v = -v;
+    }
+    v += 5;
+    v /= 10;
+
+    char buf[48];
+    char* end = buf + sizeof(buf);
+    char* p = end;
+    std::int64_t digits = v % iscale;
+    if (precision && (padzero || digits)) {
         int width = precision;
-        std::int64_t digits = v % iscale;
         if (!padzero) {
-            if (!digits) {
-                continue;
-            }
             while (digits % 10 == 0) {
                 digits /= 10;
                 --width;
             }
         }
-        str << '.' << std::setw(width) << std::right << digits;
+        for (int i = 0; i < width; i++) {
+            *--p = static_cast<char>('0' + digits % 10);
+            digits /= 10;
+        }
+        *--p = '.';
+    }
+    std::int64_t whole = v / iscale;
+    do {
+        *--p = static_cast<char>('0' + whole % 10);
+        whole /= 10;
+    } while (whole);
+    if (negative) {
+        *--p = '-';
+    }
+    str.write(p, end - p);
+}
+
+std::string Command::toGCode(int precision, bool padzero) const
+{
+    std::stringstream str;
+    str << Name;
+    for (std::map<std::string, double>::const_iterator i = Parameters.begin();
+         i != Parameters.end();
+         ++i) {
+        if (i->first == "N") {
+            continue;
+        }
+        writeParameter(str, i->first, i->second, precision, padzero);
     }
     return str.str();
 }
@@ -24,8 +24,11 @@
 #ifndef PATH_COMMAND_H
 #define PATH_COMMAND_H
 
+#include <cstdint>
 #include <map>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <Base/Persistence.h>
 #include <Base/Placement.h>
 #include <Base/Vector3D.h>
@@ -39,6 +42,16 @@ class PathExport Command: public Base::Persistence
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
 
 public:
+    /// the kind of move of a command, derived from its name
+    enum class Opcode : std::uint8_t
+    {
+        Other,
+        Rapid,   // G0
+        Linear,  // G1
+        ArcCW,   // G2
+        ArcCCW,  // G3
+    };
+
     // constructors
     Command();
     Command(const char* name, const std::map<std::string, double>& parameters);
@@ -67,6 +80,13 @@ public:
     double getValue(const std::string& name) const;  // returns the value of a given parameter
     void scaleBy(double factor);  // scales the receiver - use for imperial/metric conversions
 
+    static Opcode getOpcode(const std::string& name);  // returns the kind of move of a name
+    static void writeParameter(std::ostream& str,
+                               std::string_view key,
+                               double value,
+                               int precision,
+                               bool padzero);  // writes " <key><value>" the way toGCode does
+
     // this assumes the name is upper case
     inline double getParam(const std::string& name, double fallback = 0.0) const
     {
@@ -212,10 +212,12 @@ void CommandPy::setParameters(Py::Dict arg)
 
 PyObject* CommandPy::toGCode(PyObject* args) const
 {
-    if (PyArg_ParseTuple(args, "")) {
-        return PyUnicode_FromString(getCommandPtr()->toGCode().c_str());
+    int precision = 6;
+    int padzero = 1;
+    if (PyArg_ParseTuple(args, "|ip", &precision, &padzero)) {
+        return PyUnicode_FromString(getCommandPtr()->toGCode(precision, padzero != 0).c_str());
     }
-    throw Py::TypeError("This method accepts no argument");
+    return nullptr;
 }
 
 PyObject* CommandPy::setFromGCode(PyObject* args)
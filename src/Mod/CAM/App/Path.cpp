@@ -21,9 +21,18 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <sstream>
+#include <string_view>
+#include <boost/algorithm/string.hpp>
+#endif
 
 #include <App/Application.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
@@ -37,11 +46,321 @@ using namespace Base;
 
 TYPESYSTEM_SOURCE(Path::Toolpath, Base::Persistence)
 
+namespace
+{
+
+// returns the value of a single letter parameter of a command stored in columns
+inline double letterValue(std::uint32_t mask, const double* values, char letter, double fallback)
+{
+    std::uint32_t bit = 1U << (letter - 'A');
+    if (!(mask & bit)) {
+        return fallback;
+    }
+    return values[std::popcount(mask & (bit - 1))];
+}
+
+inline bool isLetterKey(const std::string& key)
+{
+    return key.size() == 1 && key[0] >= 'A' && key[0] <= 'Z';
+}
+
+// moves the extra parameters of the commands from index 'from' on by 'delta' positions
+void shiftExtraParams(std::map<unsigned int, std::map<std::string, double>>& extraParams,
+                      unsigned int from,
+                      int delta)
+{
+    std::map<unsigned int, std::map<std::string, double>> moved;
+    for (auto it = extraParams.lower_bound(from); it != extraParams.end();) {
+        moved.emplace(it->first + delta, std::move(it->second));
+        it = extraParams.erase(it);
+    }
+    extraParams.merge(moved);
+}
+
+// a command parsed from GCode, with the parameter values indexed by letter
+struct ParsedCommand
+{
+    std::string name;
+    std::uint32_t mask = 0;
+    double values[26];
+};
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline bool isAlpha(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline char toUpper(char c)
+{
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+}
+
+// converts a number the way std::atof() does, exactly computing the usual short decimals
+double parseNumber(const char* str, std::size_t length)
+{
+    static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char* p = str;
+    const char* end = str + length;
+    bool negative = p != end && *p == '-';
+    if (negative) {
+        ++p;
+    }
+    std::uint64_t mantissa = 0;
+    int count = 0;
+    int decimals = 0;
+    for (; p != end && isDigit(*p) && count < 19; ++p, ++count) {
+        mantissa = mantissa * 10 + (*p - '0');
+    }
+    if (p != end && *p == '.') {
+        for (++p; p != end && isDigit(*p) && count < 19; ++p, ++count, ++decimals) {
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+    }
+    if (count == 0) {
+        return 0.0;
+    }
+    if ((p != end && isDigit(*p)) || mantissa > (std::uint64_t(1) << 53)) {
+        // too many digits to be exact, leave it to the library
+        char buf[40];
+        std::size_t n = std::min(length, sizeof(buf) - 1);
+        std::copy(str, str + n, buf);
+        buf[n] = 0;
+        return std::strtod(buf, nullptr);
+    }
+    // both operands are exact, so the division rounds correctly
+    double value = static_cast<double>(mantissa) / powers[decimals];
+    return negative ? -value : value;
+}
+
+// Parses one command the way Command::setFromGCode() does, without allocating. Returns false for
+// anything unusual, including malformed input, which is then left to Command.
+bool parseCommand(std::string_view gcode, ParsedCommand& cmd)
+{
+    cmd.mask = 0;
+    if (gcode.empty()) {
+        return false;
+    }
+    if (gcode.front() == '(') {
+        // a comment is taken verbatim, unless it is nested
+        if (gcode.back() != ')' || gcode.find('(', 1) != std::string_view::npos) {
+            return false;
+        }
+        cmd.name.assign(gcode);
+        return true;
+    }
+
+    bool named = false;
+    char key = 0;
+    char value[32];
+    std::size_t length = 0;
+    auto store = [&]() {
+        if (!named) {
+            cmd.name.assign(1, toUpper(key));
+            cmd.name.append(value, length);
+            named = true;
+        }
+        else {
+            int letter = toUpper(key) - 'A';
+            cmd.values[letter] = parseNumber(value, length);
+            cmd.mask |= 1U << letter;
+        }
+    };
+    for (char c : gcode) {
+        if (isDigit(c) || c == '-' || c == '.') {
+            if (length == sizeof(value)) {
+                return false;
+            }
+            value[length++] = c;
+        }
+        else if (isAlpha(c)) {
+            if (key) {
+                if (!length) {
+                    return false;
+                }
+                store();
+                length = 0;
+            }
+            else if (length) {
+                return false;
+            }
+            key = c;
+        }
+        else if (c == '(' || c == ')' || static_cast<unsigned char>(c) >= 0x80) {
+            return false;
+        }
+    }
+    if (!key || !length) {
+        return false;
+    }
+    store();
+    return true;
+}
+
+// Splits GCode into commands at every G, M or comment, as it arrives in consecutive blocks.
+// Anything before the first command or between a comment and the next command is dropped.
+class GCodeSplitter
+{
+public:
+    template<typename Func>
+    void feed(std::string_view block, Func&& addCommand)
+    {
+        std::size_t start = 0;
+        std::size_t pos = 0;
+        auto emit = [&](std::size_t end) {
+            if (pending.empty()) {
+                addCommand(block.substr(start, end - start));
+            }
+            else {
+                pending.append(block.substr(start, end - start));
+                addCommand(std::string_view(pending));
+                pending.clear();
+            }
+        };
+        while (pos < block.size()) {
+            if (comment) {
+                std::size_t found = block.find(')', pos);
+                if (found == std::string_view::npos) {
+                    break;
+                }
+                emit(found + 1);
+                active = false;
+                comment = false;
+                pos = found + 1;
+            }
+            else {
+                std::size_t found = block.find_first_of("(gGmM", pos);
+                if (found == std::string_view::npos) {
+                    break;
+                }
+                if (active) {
+                    emit(found);
+                }
+                active = true;
+                comment = block[found] == '(';
+                start = found;
+                pos = found + 1;
+            }
+        }
+        if (active) {
+            pending.append(block.substr(start));
+        }
+    }
+
+    template<typename Func>
+    void finish(Func&& addCommand)
+    {
+        // an unterminated comment is dropped
+        if (active && !comment) {
+            addCommand(std::string_view(pending));
+        }
+        pending.clear();
+        active = false;
+        comment = false;
+    }
+
+private:
+    std::string pending;  // the start of the current command, from previous blocks
+    bool active = false;
+    bool comment = false;
+};
+
+}  // namespace
+
+// CommandView
+
+CommandView::CommandView(const Toolpath& toolpath, unsigned int index)
+    : Name(toolpath.names[toolpath.cmdNames[index]])
+    , path(toolpath)
+    , pos(index)
+{}
+
+double CommandView::getParam(const std::string& name, double fallback) const
+{
+    const double* value = path.findParam(pos, name);
+    return value ? *value : fallback;
+}
+
+Placement CommandView::getPlacement(const Base::Vector3d pos) const
+{
+    std::uint32_t mask = path.cmdMasks[this->pos];
+    const double* values = path.values.data() + path.cmdOffsets[this->pos];
+    Vector3d vec(letterValue(mask, values, 'X', pos.x),
+                 letterValue(mask, values, 'Y', pos.y),
+                 letterValue(mask, values, 'Z', pos.z));
+    Rotation rot;
+    rot.setYawPitchRoll(letterValue(mask, values, 'A', 0.0),
+                        letterValue(mask, values, 'B', 0.0),
+                        letterValue(mask, values, 'C', 0.0));
+    return Placement(vec, rot);
+}
+
+Vector3d CommandView::getCenter() const
+{
+    std::uint32_t mask = path.cmdMasks[pos];
+    const double* values = path.values.data() + path.cmdOffsets[pos];
+    return Vector3d(letterValue(mask, values, 'I', 0.0),
+                    letterValue(mask, values, 'J', 0.0),
+                    letterValue(mask, values, 'K', 0.0));
+}
+
+std::string CommandView::toGCode(int precision, bool padzero) const
+{
+    std::stringstream str;
+    path.writeGCode(str, pos, precision, padzero);
+    return str.str();
+}
+
+bool CommandView::has(const std::string& attr) const
+{
+    std::string a(attr);
+    boost::to_upper(a);
+    return path.findParam(pos, a) != nullptr;
+}
+
+double CommandView::getValue(const std::string& attr) const
+{
+    std::string a(attr);
+    boost::to_upper(a);
+    return getParam(a);
+}
+
+Command::Opcode CommandView::getOpcode() const
+{
+    return path.nameOpcodes[path.cmdNames[pos]];
+}
+
+Command CommandView::toCommand() const
+{
+    Command cmd;
+    cmd.Name = Name;
+    std::uint32_t mask = path.cmdMasks[pos];
+    const double* values = path.values.data() + path.cmdOffsets[pos];
+    for (std::uint32_t bits = mask & ~Toolpath::ExtraParamsBit; bits; bits &= bits - 1) {
+        char key = static_cast<char>('A' + std::countr_zero(bits));
+        cmd.Parameters.emplace_hint(cmd.Parameters.end(), std::string(1, key), *values++);
+    }
+    if (mask & Toolpath::ExtraParamsBit) {
+        const auto& params = path.extraParams.find(pos)->second;
+        cmd.Parameters.insert(params.begin(), params.end());
+    }
+    return cmd;
+}
+
+// Toolpath
+
 Toolpath::Toolpath()
+    : cmdOffsets(1, 0)
 {}
 
 Toolpath::Toolpath(const Toolpath& otherPath)
-    : vpcCommands(otherPath.vpcCommands.size())
+    : cmdOffsets(1, 0)
     , center(otherPath.center)
 {
     *this = otherPath;
@@ -49,9 +368,7 @@ Toolpath::Toolpath(const Toolpath& otherPath)
 }
 
 Toolpath::~Toolpath()
-{
-    clear();
-}
+{}
 
 Toolpath& Toolpath::operator=(const Toolpath& otherPath)
 {
@@ -59,14 +376,14 @@ Toolpath& Toolpath::operator=(const Toolpath& otherPath)
         return *this;
     }
 
-    clear();
-    vpcCommands.resize(otherPath.vpcCommands.size());
-    int i = 0;
-    for (std::vector<Command*>::const_iterator it = otherPath.vpcCommands.begin();
-         it != otherPath.vpcCommands.end();
-         ++it, i++) {
-        vpcCommands[i] = new Command(**it);
-    }
+    cmdNames = otherPath.cmdNames;
+    cmdMasks = otherPath.cmdMasks;
+    cmdOffsets = otherPath.cmdOffsets;
+    values = otherPath.values;
+    extraParams = otherPath.extraParams;
+    names = otherPath.names;
+    nameOpcodes = otherPath.nameOpcodes;
+    nameIndex = otherPath.nameIndex;
     center = otherPath.center;
     recalculate();
     return *this;
@@ -74,17 +391,135 @@ Toolpath& Toolpath::operator=(const Toolpath& otherPath)
 
 void Toolpath::clear()
 {
-    for (std::vector<Command*>::iterator it = vpcCommands.begin(); it != vpcCommands.end(); ++it) {
-        delete (*it);
-    }
-    vpcCommands.clear();
+    cmdNames.clear();
+    cmdMasks.clear();
+    cmdOffsets.assign(1, 0);
+    values.clear();
+    extraParams.clear();
+    names.clear();
+    nameOpcodes.clear();
+    nameIndex.clear();
     recalculate();
 }
 
+std::uint32_t Toolpath::internName(const std::string& name)
+{
+    // consecutive commands mostly share their name
+    if (!cmdNames.empty() && names[cmdNames.back()] == name) {
+        return cmdNames.back();
+    }
+    auto it = nameIndex.find(name);
+    if (it != nameIndex.end()) {
+        return it->second;
+    }
+    auto index = static_cast<std::uint32_t>(names.size());
+    names.push_back(name);
+    nameOpcodes.push_back(Command::getOpcode(name));
+    nameIndex.emplace(name, index);
+    return index;
+}
+
+void Toolpath::storeCommand(unsigned int pos, const Command& cmd)
+{
+    // the parameters are sorted by key, so the letters come in the order of the mask bits
+    double letterValues[26];
+    std::uint32_t count = 0;
+    std::uint32_t mask = 0;
+    std::map<std::string, double> extra;
+    for (const auto& [key, value] : cmd.Parameters) {
+        if (isLetterKey(key)) {
+            mask |= 1U << (key[0] - 'A');
+            letterValues[count++] = value;
+        }
+        else {
+            extra.emplace(key, value);
+        }
+    }
+
+    if (pos < getSize()) {
+        shiftExtraParams(extraParams, pos, 1);
+    }
+    if (!extra.empty()) {
+        mask |= ExtraParamsBit;
+        extraParams.emplace(pos, std::move(extra));
+    }
+
+    std::uint32_t offset = cmdOffsets[pos];
+    values.insert(values.begin() + offset, letterValues, letterValues + count);
+    for (std::size_t i = pos; i < cmdOffsets.size(); i++) {
+        cmdOffsets[i] += count;
+    }
+    cmdOffsets.insert(cmdOffsets.begin() + pos, offset);
+    cmdMasks.insert(cmdMasks.begin() + pos, mask);
+    cmdNames.insert(cmdNames.begin() + pos, internName(cmd.Name));
+}
+
+void Toolpath::appendCommand(const std::string& name,
+                             std::uint32_t mask,
+                             const double* letterValues)
+{
+    for (std::uint32_t bits = mask; bits; bits &= bits - 1) {
+        values.push_back(letterValues[std::countr_zero(bits)]);
+    }
+    cmdOffsets.push_back(static_cast<std::uint32_t>(values.size()));
+    cmdMasks.push_back(mask);
+    cmdNames.push_back(internName(name));
+}
+
+const double* Toolpath::findParam(unsigned int pos, const std::string& name) const
+{
+    std::uint32_t mask = cmdMasks[pos];
+    if (isLetterKey(name)) {
+        std::uint32_t bit = 1U << (name[0] - 'A');
+        if (!(mask & bit)) {
+            return nullptr;
+        }
+        return values.data() + cmdOffsets[pos] + std::popcount(mask & (bit - 1));
+    }
+    if (!(mask & ExtraParamsBit)) {
+        return nullptr;
+    }
+    const auto& params = extraParams.find(pos)->second;
+    auto it = params.find(name);
+    return it != params.end() ? &it->second : nullptr;
+}
+
+Base::Vector3d Toolpath::getPosition(unsigned int pos, const Base::Vector3d& last) const
+{
+    std::uint32_t mask = cmdMasks[pos];
+    const double* vals = values.data() + cmdOffsets[pos];
+    return Vector3d(letterValue(mask, vals, 'X', last.x),
+                    letterValue(mask, vals, 'Y', last.y),
+                    letterValue(mask, vals, 'Z', last.z));
+}
+
+void Toolpath::writeGCode(std::ostream& str, unsigned int pos, int precision, bool padzero) const
+{
+    const std::string& name = names[cmdNames[pos]];
+    str.write(name.data(), static_cast<std::streamsize>(name.size()));
+    std::uint32_t mask = cmdMasks[pos];
+    if (mask & ExtraParamsBit) {
+        // keys other than single letters may sort in between the letters
+        for (const auto& [key, value] : getCommand(pos).toCommand().Parameters) {
+            if (key != "N") {
+                Command::writeParameter(str, key, value, precision, padzero);
+            }
+        }
+        return;
+    }
+    const double* vals = values.data() + cmdOffsets[pos];
+    for (std::uint32_t bits = mask; bits; bits &= bits - 1) {
+        char key = static_cast<char>('A' + std::countr_zero(bits));
+        double value = *vals++;
+        if (key != 'N') {
+            Command::writeParameter(str, std::string_view(&key, 1), value, precision, padzero);
+        }
+    }
+}
+
 void Toolpath::addCommand(const Command& Cmd)
 {
-    Command* tmp = new Command(Cmd);
-    vpcCommands.push_back(tmp);
+    storeCommand(getSize(), Cmd);
     recalculate();
 }
 
@@ -93,9 +528,8 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
     if (pos == -1) {
         addCommand(Cmd);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        Command* tmp = new Command(Cmd);
-        vpcCommands.insert(vpcCommands.begin() + pos, tmp);
+    else if (pos >= 0 && pos <= static_cast<int>(getSize())) {
+        storeCommand(pos, Cmd);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -106,43 +540,54 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
 void Toolpath::deleteCommand(int pos)
 {
     if (pos == -1) {
-        // delete(*vpcCommands.rbegin()); // causes crash
-        vpcCommands.pop_back();
-    }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        vpcCommands.erase(vpcCommands.begin() + pos);
+        pos = static_cast<int>(getSize()) - 1;
     }
-    else {
+    if (pos < 0 || pos >= static_cast<int>(getSize())) {
         throw Base::IndexError("Index not in range");
     }
+
+    std::uint32_t first = cmdOffsets[pos];
+    std::uint32_t count = cmdOffsets[pos + 1] - first;
+    values.erase(values.begin() + first, values.begin() + first + count);
+    cmdOffsets.erase(cmdOffsets.begin() + pos);
+    for (std::size_t i = pos; i < cmdOffsets.size(); i++) {
+        cmdOffsets[i] -= count;
+    }
+    if (cmdMasks[pos] & ExtraParamsBit) {
+        extraParams.erase(pos);
+    }
+    shiftExtraParams(extraParams, pos + 1, -1);
+    cmdMasks.erase(cmdMasks.begin() + pos);
+    cmdNames.erase(cmdNames.begin() + pos);
     recalculate();
 }
 
 double Toolpath::getLength()
 {
-    if (vpcCommands.empty()) {
+    if (cmdNames.empty()) {
         return 0;
     }
     double l = 0;
     Vector3d last(0, 0, 0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        next = (*it)->getPlacement(last).getPosition();
-        if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
+    for (unsigned int i = 0; i < getSize(); i++) {
+        Command::Opcode op = nameOpcodes[cmdNames[i]];
+        if (op == Command::Opcode::Other) {
+            continue;
+        }
+        next = getPosition(i, last);
+        if (op == Command::Opcode::Rapid || op == Command::Opcode::Linear) {
             // straight line
             l += (next - last).Length();
-            last = next;
         }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
+        else {
             // arc
-            Vector3d center = (*it)->getCenter();
+            Vector3d center = getCommand(i).getCenter();
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
-            last = next;
         }
+        last = next;
     }
     return l;
 }
@@ -167,7 +612,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         vRapid = vFeed;
     }
 
-    if (vpcCommands.empty()) {
+    if (cmdNames.empty()) {
         return 0;
     }
     double l = 0;
@@ -175,22 +620,21 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
     bool verticalMove = false;
     Vector3d last(0, 0, 0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        float feedrate = (*it)->getParam("F");
+    for (unsigned int i = 0; i < getSize(); i++) {
+        Command::Opcode op = nameOpcodes[cmdNames[i]];
+        float feedrate;
 
         l = 0;
         verticalMove = false;
         feedrate = hFeed;
-        next = (*it)->getPlacement(last).getPosition();
+        next = getPosition(i, last);
 
         if (last.z != next.z) {
             verticalMove = true;
             feedrate = vFeed;
         }
 
-        if ((name == "G0") || (name == "G00")) {
+        if (op == Command::Opcode::Rapid) {
             // Rapid Move
             l += (next - last).Length();
             feedrate = hRapid;
@@ -198,13 +642,13 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
                 feedrate = vRapid;
             }
         }
-        else if ((name == "G1") || (name == "G01")) {
+        else if (op == Command::Opcode::Linear) {
             // Feed Move
             l += (next - last).Length();
         }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
+        else if (op == Command::Opcode::ArcCW || op == Command::Opcode::ArcCCW) {
             // Arc Move
-            Vector3d center = (*it)->getCenter();
+            Vector3d center = getCommand(i).getCenter();
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -304,96 +748,97 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void
-bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
+void Toolpath::bulkAddCommand(std::string_view gcodestr, bool& inches)
 {
-    Command* cmd = new Command();
-    cmd->setFromGCode(gcodestr);
-    if ("G20" == cmd->Name) {
+    ParsedCommand parsed;
+    if (!parseCommand(gcodestr, parsed)) {
+        // let Command deal with the unusual cases, and report malformed input
+        Command cmd;
+        cmd.setFromGCode(std::string(gcodestr));
+        if ("G20" == cmd.Name) {
+            inches = true;
+        }
+        else if ("G21" == cmd.Name) {
+            inches = false;
+        }
+        else {
+            if (inches) {
+                cmd.scaleBy(25.4);
+            }
+            storeCommand(getSize(), cmd);
+        }
+        return;
+    }
+
+    if ("G20" == parsed.name) {
         inches = true;
-        delete cmd;
     }
-    else if ("G21" == cmd->Name) {
+    else if ("G21" == parsed.name) {
         inches = false;
-        delete cmd;
     }
     else {
         if (inches) {
-            cmd->scaleBy(25.4);
+            // the same parameters as Command::scaleBy()
+            for (char c : {'X', 'Y', 'Z', 'I', 'J', 'R', 'Q', 'F'}) {
+                if (parsed.mask & (1U << (c - 'A'))) {
+                    parsed.values[c - 'A'] *= 25.4;
+                }
+            }
         }
-        commands.push_back(cmd);
+        appendCommand(parsed.name, parsed.mask, parsed.values);
     }
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+void Toolpath::setFromGCode(std::string_view gcode)
 {
     clear();
 
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
+    bool inches = false;
+    GCodeSplitter splitter;
+    auto addCommand = [&](std::string_view gcodestr) {
+        bulkAddCommand(gcodestr, inches);
+    };
+    splitter.feed(gcode, addCommand);
+    splitter.finish(addCommand);
+    recalculate();
+}
+
+void Toolpath::readGCode(std::istream& str)
+{
+    clear();
 
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
     bool inches = false;
-    while (found != std::string::npos) {
-        if (str[found] == '(') {
-            // start of comment
-            if ((last > -1) && (mode == "command")) {
-                // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            mode = "comment";
-            last = found;
-            found = str.find_first_of(')', found + 1);
-        }
-        else if (str[found] == ')') {
-            // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found + 1);
-            mode = "command";
-        }
-        else if (mode == "command") {
-            // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            last = found;
-            found = str.find_first_of("(gGmM", found + 1);
-        }
-    }
-    // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-        }
-    }
+    GCodeSplitter splitter;
+    auto addCommand = [&](std::string_view gcodestr) {
+        bulkAddCommand(gcodestr, inches);
+    };
+    std::vector<char> buffer(1 << 20);
+    while (str.read(buffer.data(), buffer.size()) || str.gcount() > 0) {
+        splitter.feed(std::string_view(buffer.data(), str.gcount()), addCommand);
+    }
+    splitter.finish(addCommand);
     recalculate();
 }
 
 std::string Toolpath::toGCode() const
 {
-    std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
-        result += "\n";
+    std::stringstream str;
+    toGCode(str);
+    return str.str();
+}
+
+void Toolpath::toGCode(std::ostream& str) const
+{
+    for (unsigned int i = 0; i < getSize(); i++) {
+        writeGCode(str, i, 6, true);
+        str.put('\n');
     }
-    return result;
 }
 
 void Toolpath::recalculate()  // recalculates the path cache
 {
 
-    if (vpcCommands.empty()) {
+    if (cmdNames.empty()) {
         return;
     }
 
@@ -481,7 +926,7 @@ void Toolpath::Save(Writer& writer) const
         writer.incInd();
         saveCenter(writer, center);
         for (unsigned int i = 0; i < getSize(); i++) {
-            vpcCommands[i]->Save(writer);
+            getCommand(i).toCommand().Save(writer);
         }
         writer.decInd();
     }
@@ -498,10 +943,7 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
-        return;
-    }
-    writer.Stream() << toGCode();
+    toGCode(writer.Stream());
 }
 
 void Toolpath::Restore(XMLReader& reader)
@@ -517,11 +959,5 @@ void Toolpath::Restore(XMLReader& reader)
 
 void Toolpath::RestoreDocFile(Base::Reader& reader)
 {
-    std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
-    }
-    setFromGCode(gcode);
+    readGCode(reader);
 }
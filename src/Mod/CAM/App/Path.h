@@ -23,6 +23,15 @@
 #ifndef PATH_Path_H
 #define PATH_Path_H
 
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include <Base/BoundBox.h>
 #include <Base/Persistence.h>
 #include <Base/Vector3D.h>
@@ -33,7 +42,47 @@
 namespace Path
 {
 
-/** The representation of a CNC Toolpath */
+class Toolpath;
+
+/** A read-only view of one command stored in a Toolpath
+ *
+ * It offers the query interface of Command without copying the command out of the toolpath. A
+ * view is only valid as long as the toolpath it refers to is not modified.
+ */
+class PathExport CommandView
+{
+public:
+    CommandView(const Toolpath& toolpath, unsigned int index);
+
+    Base::Placement getPlacement(const Base::Vector3d pos = Base::Vector3d())
+        const;                         // returns a placement from the x,y,z,a,b,c parameters
+    Base::Vector3d getCenter() const;  // returns a 3d vector from the i,j,k parameters
+    std::string
+    toGCode(int precision = 6,
+            bool padzero = true) const;  // returns a GCode string representation of the command
+    bool
+    has(const std::string&) const;  // returns true if the given string exists in the parameters
+    double getValue(const std::string& name) const;  // returns the value of a given parameter
+    Command::Opcode getOpcode() const;               // returns the kind of move of the command
+    Command toCommand() const;                       // returns a standalone copy of the command
+
+    // this assumes the name is upper case
+    double getParam(const std::string& name, double fallback = 0.0) const;
+
+    const std::string& Name;
+
+private:
+    const Toolpath& path;
+    unsigned int pos;
+};
+
+/** The representation of a CNC Toolpath
+ *
+ * The commands are not stored as individual Command objects but in columns: an interned name, a
+ * bit mask of the single letter parameters present and an offset into one array holding the
+ * parameter values of all commands in letter order. Parameters whose key is not a single upper
+ * case letter are kept aside per command. Use getCommand() to query a stored command.
+ */
 
 class PathExport Toolpath: public Base::Persistence
 {
@@ -61,23 +110,20 @@ public:
     double getLength();                                   // return the Length (mm) of the Path
     double getCycleTime(double, double, double, double);  // return the Cycle Time (s) of the Path
     void recalculate();                                   // recalculates the points
-    void
-    setFromGCode(const std::string);  // sets the path from the contents of the given GCode string
-    std::string toGCode() const;      // gets a gcode string representation from the Path
+    void setFromGCode(std::string_view);  // sets the path from the contents of the given GCode
+    void readGCode(std::istream&);        // sets the path from the GCode read from a stream
+    std::string toGCode() const;          // gets a gcode string representation from the Path
+    void toGCode(std::ostream&) const;    // writes the gcode of the Path to a stream
     Base::BoundBox3d getBoundBox() const;
 
     // shortcut functions
     unsigned int getSize() const
     {
-        return vpcCommands.size();
+        return cmdNames.size();
     }
-    const std::vector<Command*>& getCommands() const
+    CommandView getCommand(unsigned int pos) const
     {
-        return vpcCommands;
-    }
-    const Command& getCommand(unsigned int pos) const
-    {
-        return *vpcCommands[pos];
+        return CommandView(*this, pos);
     }
 
     // support for rotation
@@ -90,7 +136,29 @@ public:
     static const int SchemaVersion = 2;
 
 protected:
-    std::vector<Command*> vpcCommands;
+    friend class CommandView;
+
+    // bit of cmdMasks flagging a command with parameters in extraParams
+    static const std::uint32_t ExtraParamsBit = 1U << 31;
+
+    void storeCommand(unsigned int pos, const Command& cmd);
+    void appendCommand(const std::string& name, std::uint32_t mask, const double* letterValues);
+    void bulkAddCommand(std::string_view gcodestr, bool& inches);
+    std::uint32_t internName(const std::string& name);
+    const double* findParam(unsigned int pos, const std::string& name) const;
+    Base::Vector3d getPosition(unsigned int pos, const Base::Vector3d& last) const;
+    void writeGCode(std::ostream& str, unsigned int pos, int precision, bool padzero) const;
+
+    std::vector<std::uint32_t> cmdNames;    // index into names
+    std::vector<std::uint32_t> cmdMasks;    // bit n set if the letter 'A'+n is a parameter
+    std::vector<std::uint32_t> cmdOffsets;  // first value of each command, plus the end
+    std::vector<double> values;
+    std::map<unsigned int, std::map<std::string, double>> extraParams;
+
+    std::vector<std::string> names;
+    std::vector<Command::Opcode> nameOpcodes;
+    std::unordered_map<std::string, std::uint32_t> nameIndex;
+
     Base::Vector3d center;
     // KDL::Path_Composite *pcPath;
 
@@ -90,8 +90,8 @@ Py::List PathPy::getCommands() const
 {
     Py::List list;
     for (unsigned int i = 0; i < getToolpathPtr()->getSize(); i++) {
-        list.append(
-            Py::asObject(new Path::CommandPy(new Path::Command(getToolpathPtr()->getCommand(i)))));
+        Path::Command* cmd = new Path::Command(getToolpathPtr()->getCommand(i).toCommand());
+        list.append(Py::asObject(new Path::CommandPy(cmd)));
     }
     return list;
 }
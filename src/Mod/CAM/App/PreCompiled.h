@@ -43,12 +43,17 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <bit>
 #include <cinttypes>
+#include <cstdlib>
 #include <iomanip>
 #include <limits>
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 // Boost
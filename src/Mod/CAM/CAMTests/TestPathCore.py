@@ -20,6 +20,9 @@
 # *                                                                         *
 # ***************************************************************************
 
+import os
+import tempfile
+
 import FreeCAD
 import Path
 from CAMTests.PathTestUtils import PathTestBase
@@ -126,6 +129,126 @@ G0 Z0.500000
         p.setFromGCode(lines)
         self.assertEqual(p.toGCode(), output)
 
+    def test20(self):
+        """Test Path output of commands with extra parameters"""
+        # keys other than a single letter are written in order among the letters
+        c = Path.Command("G1", {"X": 1, "X1": 2, "B2": 3, "Y": 4})
+        self.assertEqual(str(c), "Command G1 [ B2:3 X:1 X1:2 Y:4 ]")
+        self.assertEqual(c.toGCode(), "G1 B23.000000 X1.000000 X12.000000 Y4.000000")
+
+        p = Path.Path([Path.Command("G0", {"X": 1}), c, Path.Command("G1", {"Y": 2})])
+        self.assertEqual(
+            p.toGCode(),
+            "G0 X1.000000\nG1 B23.000000 X1.000000 X12.000000 Y4.000000\nG1 Y2.000000\n",
+        )
+        self.assertEqual(str(p.Commands[1]), str(c))
+
+        # commands are returned as copies
+        p.Commands[1].Parameters = {"X": 5}
+        self.assertEqual(str(p.Commands[1]), str(c))
+
+    def test21(self):
+        """Test inserting and deleting commands with extra parameters"""
+        c = Path.Command("G1", {"X": 1, "X1": 2, "B2": 3, "Y": 4})
+        g0 = Path.Command("G0", {"X": 1})
+        p = Path.Path([g0, Path.Command("G1", {"Y": 2})])
+
+        p.insertCommand(c, 1)
+        self.assertEqual(len(p.Commands), 3)
+        self.assertEqual(str(p.Commands[1]), str(c))
+        self.assertEqual(p.Commands[1].toGCode(), c.toGCode())
+
+        # the extra parameters move with their command
+        p.deleteCommand(0)
+        self.assertEqual(str(p.Commands[0]), str(c))
+        p.insertCommand(g0, 1)
+        self.assertEqual(
+            p.toGCode(),
+            "G1 B23.000000 X1.000000 X12.000000 Y4.000000\nG0 X1.000000\nG1 Y2.000000\n",
+        )
+        p.deleteCommand(1)
+        self.assertEqual(
+            p.toGCode(), "G1 B23.000000 X1.000000 X12.000000 Y4.000000\nG1 Y2.000000\n"
+        )
+        self.assertEqual(str(p.Commands[1]), "Command G1 [ Y:2 ]")
+
+        # deleting past the end raises
+        with self.assertRaises(IndexError):
+            p.deleteCommand(len(p.Commands))
+        self.assertEqual(len(p.Commands), 2)
+
+    def test30(self):
+        """Test comments in gcode"""
+        p = Path.Path()
+        p.setFromGCode("G0 X1 (a(b) G1 X2 (open G1 X3")
+        # a nested comment is kept without the inner bracket, an unterminated one is dropped
+        self.assertEqual(p.toGCode(), "G0 X1.000000\n(ab)\nG1 X2.000000\n")
+
+        p.setFromGCode("(hello) G1 X2 (open")
+        self.assertEqual(p.toGCode(), "(hello)\nG1 X2.000000\n")
+
+    def test31(self):
+        """Test inch mode in gcode"""
+        p = Path.Path()
+        p.setFromGCode("G20 G1 X1 Y2 Z3 I1 J1 F10 G21 G1 X1")
+        self.assertEqual(
+            p.toGCode(),
+            "G1 F254.000000 I25.400000 J25.400000 X25.400000 Y50.800000 Z76.200000\n"
+            "G1 X1.000000\n",
+        )
+
+    def test32(self):
+        """Test numbers in gcode"""
+        p = Path.Path()
+        p.setFromGCode("G1 X1.2345678901234567890123 Y-0.5 Z0.1 A12345678901234567890")
+        c = p.Commands[0]
+        self.assertEqual(c.Parameters["X"], float("1.2345678901234567890123"))
+        self.assertEqual(c.Parameters["Y"], -0.5)
+        self.assertEqual(c.Parameters["Z"], 0.1)
+        self.assertEqual(c.Parameters["A"], float("12345678901234567890"))
+
+    def test33(self):
+        """Test gcode output precision"""
+        c = Path.Command("G1", {"X": -0.0000001, "Y": 1.5, "Z": -2.25})
+        self.assertEqual(c.toGCode(), "G1 X-0.000000 Y1.500000 Z-2.250000")
+        self.assertEqual(c.toGCode(6, False), "G1 X-0 Y1.5 Z-2.25")
+        self.assertEqual(c.toGCode(2), "G1 X0.00 Y1.50 Z-2.25")
+
+        p = Path.Path([c])
+        self.assertEqual(p.toGCode(), c.toGCode() + "\n")
+
+    def test34(self):
+        """Test reading gcode files across blocks"""
+        block = 1 << 20
+        lines = "G0 X1 Y2\n" * ((block - 6) // 9)
+        lines += " " * (block - 6 - len(lines))
+        # a command across the first block boundary
+        lines += "G1 X123.456 Y7 Z-8\n"
+        lines += "G0 X1 Y2\n" * ((2 * block - 4 - len(lines)) // 9)
+        lines += " " * (2 * block - 4 - len(lines))
+        # a comment across the second one
+        lines += "(a comment)\nG1 X1\n"
+
+        expected = Path.Path()
+        expected.setFromGCode(lines)
+
+        doc = FreeCAD.newDocument("TestPathRead")
+        try:
+            with tempfile.TemporaryDirectory() as tmp:
+                filename = os.path.join(tmp, "toolpath.gcode")
+                with open(filename, "wb") as f:
+                    f.write(lines.encode())
+                Path.read(filename, doc.Name)
+            p = doc.getObject("toolpath").Path
+            self.assertEqual(p.Size, expected.Size)
+            self.assertEqual(p.toGCode(), expected.toGCode())
+            self.assertEqual(
+                p.Commands[(block - 6) // 9].toGCode(), "G1 X123.456000 Y7.000000 Z-8.000000"
+            )
+            self.assertEqual(p.Commands[-2].toGCode(), "(a comment)")
+        finally:
+            FreeCAD.closeDocument(doc.Name)
+
     def test50(self):
         """Test Path.Length calculation"""
         commands = []
@@ -24,14 +24,21 @@
 
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
 #include <numeric>
 #include <limits>
 
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
+#include <Precision.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
 #include <gp_Pnt.hxx>
 
@@ -47,11 +54,13 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
 
@@ -472,48 +481,184 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
+namespace Inspection
+{
+class InspectNominalShape::Tessellation
+{
+public:
+    // shell of a solid or the shape itself
+    TopoDS_Shape surface;
+    std::vector<TopoDS_Face> faces;
+    // faces without triangulation are always checked exactly
+    std::vector<std::size_t> untriangulated;
+    MeshCore::MeshKernel mesh;
+    // index of the face of every facet
+    std::vector<std::size_t> facetToFace;
+    std::unique_ptr<MeshCore::MeshFacetBVH> bvh;
+    double deflection {0.0};
+};
+
+// OCC algorithms keep state between calls, so every thread gets its own
+class InspectNominalShape::ThreadData
+{
+public:
+    std::vector<std::unique_ptr<BRepExtrema_DistShapeShape>> faces;
+    std::unique_ptr<BRepExtrema_DistShapeShape> shape;
+    std::unique_ptr<BRepClass3d_SolidClassifier> classifier;
+};
+}  // namespace Inspection
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float offset)
     : _rShape(shape)
+    , tessellation(std::make_unique<Tessellation>())
+    , radius(offset)
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+    if (_rShape.IsNull()) {
+        return;
+    }
 
     // When having a solid then use its shell because otherwise the distance
     // for inner points will always be zero
-    if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
+    tessellation->surface = _rShape;
+    if (_rShape.ShapeType() == TopAbs_SOLID) {
         TopExp_Explorer xp;
         xp.Init(_rShape, TopAbs_SHELL);
         if (xp.More()) {
-            distss->LoadS1(xp.Current());
+            tessellation->surface = xp.Current();
             isSolid = true;
         }
     }
-    // distss->SetDeflection(radius);
+
+    tessellate(tessellation->surface);
+}
+
+InspectNominalShape::~InspectNominalShape() = default;
+
+void InspectNominalShape::tessellate(const TopoDS_Shape& surface)
+{
+    TopTools_IndexedMapOfShape mapOfFaces;
+    TopExp::MapShapes(surface, TopAbs_FACE, mapOfFaces);
+    if (mapOfFaces.IsEmpty()) {
+        return;
+    }
+
+    Bnd_Box bounds;
+    BRepBndLib::Add(surface, bounds);
+    if (bounds.IsVoid()) {
+        return;
+    }
+
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    gp_Pnt minPnt(xMin, yMin, zMin);
+    Standard_Real diagonal = minPnt.Distance(gp_Pnt(xMax, yMax, zMax));
+    tessellation->deflection = std::max(0.001 * diagonal, Precision::Confusion());
+    BRepMesh_IncrementalMesh(surface, tessellation->deflection);
+
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    for (int i = 1; i <= mapOfFaces.Extent(); i++) {
+        std::size_t index = tessellation->faces.size();
+        tessellation->faces.push_back(TopoDS::Face(mapOfFaces(i)));
+
+        std::vector<gp_Pnt> nodes;
+        std::vector<Poly_Triangle> triangles;
+        if (!Part::Tools::getTriangulation(tessellation->faces.back(), nodes, triangles)
+            || triangles.empty()) {
+            tessellation->untriangulated.push_back(index);
+            continue;
+        }
+
+        auto offset = static_cast<MeshCore::PointIndex>(points.size());
+        for (const auto& it : nodes) {
+            points.push_back(
+                MeshCore::MeshPoint(Base::Vector3f(float(it.X()), float(it.Y()), float(it.Z()))));
+        }
+        for (const auto& it : triangles) {
+            Standard_Integer n1 {}, n2 {}, n3 {};
+            it.Get(n1, n2, n3);
+            facets.push_back(MeshCore::MeshFacet(offset + n1, offset + n2, offset + n3));
+            tessellation->facetToFace.push_back(index);
+        }
+    }
+
+    tessellation->mesh.Adopt(points, facets);
+    tessellation->bvh = std::make_unique<MeshCore::MeshFacetBVH>(tessellation->mesh);
 }
 
-InspectNominalShape::~InspectNominalShape()
+InspectNominalShape::ThreadData& InspectNominalShape::getThreadData() const
 {
-    delete distss;
+    std::lock_guard<std::mutex> lock(threadMutex);
+    std::unique_ptr<ThreadData>& data = threadData[std::this_thread::get_id()];
+    if (!data) {
+        data = std::make_unique<ThreadData>();
+        data->faces.resize(tessellation->faces.size());
+    }
+    return *data;
 }
 
 float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 {
     gp_Pnt pnt3d(point.x, point.y, point.z);
-    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    ThreadData& data = getThreadData();
+    if (tessellation->faces.empty()) {
+        return getShapeDistance(data, pnt3d);
+    }
+
+    // The facets deviate from their faces by at most the deflection, so the nearest face is
+    // among the faces with a facet that is at most twice the deflection farther away than
+    // the nearest facet.
+    float tolerance = 2.0F * float(tessellation->deflection);
+    const float maxDist = std::numeric_limits<float>::max();
+    float facetDist = maxDist;
+    MeshCore::FacetIndex nearest = MeshCore::FACET_INDEX_MAX;
+    if (tessellation->bvh) {
+        nearest = tessellation->bvh->NearestFacet(point, maxDist, facetDist);
+    }
+    if (nearest != MeshCore::FACET_INDEX_MAX && facetDist > radius + tolerance
+        && tessellation->untriangulated.empty()) {
+        return getFarDistance(data, point, nearest);
+    }
+
+    std::vector<std::size_t> candidates = tessellation->untriangulated;
+    if (nearest != MeshCore::FACET_INDEX_MAX) {
+        std::vector<MeshCore::FacetIndex> facets;
+        tessellation->bvh->Inside(Base::BoundBox3f(point, facetDist + tolerance), facets);
+        for (MeshCore::FacetIndex it : facets) {
+            if (tessellation->mesh.GetFacet(it).DistanceToPoint(point) <= facetDist + tolerance) {
+                candidates.push_back(tessellation->facetToFace[it]);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
 
+    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
+    BRepExtrema_DistShapeShape* nearestFace = nullptr;
     float fMinDist = std::numeric_limits<float>::max();
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
+    for (std::size_t index : candidates) {
+        std::unique_ptr<BRepExtrema_DistShapeShape>& distss = data.faces[index];
+        if (!distss) {
+            distss = std::make_unique<BRepExtrema_DistShapeShape>();
+            distss->LoadS1(tessellation->faces[index]);
+        }
+        distss->LoadS2(mkVert.Vertex());
+        if (distss->Perform() && distss->NbSolution() > 0 && distss->Value() < fMinDist) {
+            fMinDist = (float)distss->Value();
+            nearestFace = distss.get();
+        }
+    }
+
+    if (nearestFace) {
         // the shape is a solid, check if the vertex is inside
         if (isSolid) {
-            if (isInsideSolid(pnt3d)) {
+            if (isInsideSolid(data, pnt3d)) {
                 fMinDist = -fMinDist;
             }
         }
         else if (fMinDist > 0) {
             // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
+            if (isBelowFace(*nearestFace, pnt3d)) {
                 fMinDist = -fMinDist;
             }
         }
@@ -521,23 +666,63 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
     return fMinDist;
 }
 
-bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
+float InspectNominalShape::getShapeDistance(ThreadData& data, const gp_Pnt& pnt3d) const
 {
+    // shapes without faces are checked as a whole
+    if (!data.shape) {
+        data.shape = std::make_unique<BRepExtrema_DistShapeShape>();
+        data.shape->LoadS1(_rShape);
+    }
+
+    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
+    data.shape->LoadS2(mkVert.Vertex());
+
+    float fMinDist = std::numeric_limits<float>::max();
+    if (data.shape->Perform() && data.shape->NbSolution() > 0) {
+        fMinDist = (float)data.shape->Value();
+    }
+    return fMinDist;
+}
+
+float InspectNominalShape::getFarDistance(ThreadData& data,
+                                          const Base::Vector3f& point,
+                                          MeshCore::FacetIndex facet) const
+{
+    // the point is outside of the search radius so only the side matters
+    bool below {};
+    if (isSolid) {
+        below = isInsideSolid(data, gp_Pnt(point.x, point.y, point.z));
+    }
+    else {
+        MeshCore::MeshGeomFacet geomFace = tessellation->mesh.GetFacet(facet);
+        below = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) < 0;
+    }
+
+    return below ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+}
+
+bool InspectNominalShape::isInsideSolid(ThreadData& data, const gp_Pnt& pnt3d) const
+{
+    // loading the solid is expensive, so the classifier is kept for all points
+    if (!data.classifier) {
+        data.classifier = std::make_unique<BRepClass3d_SolidClassifier>(_rShape);
+    }
+
     const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    data.classifier->Perform(pnt3d, tol);
+    return (data.classifier->State() == TopAbs_IN);
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::isBelowFace(const BRepExtrema_DistShapeShape& distss,
+                                      const gp_Pnt& pnt3d) const
 {
     // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
+    for (Standard_Integer index = 1; index <= distss.NbSolution(); index++) {
+        if (distss.SupportTypeShape1(index) == BRepExtrema_IsInFace) {
+            TopoDS_Shape face = distss.SupportOnShape1(index);
             Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
+            distss.ParOnFaceS1(index, u, v);
+            // gp_Pnt pnt = distss.PointOnShape1(index);
             BRepGProp_Face props(TopoDS::Face(face));
             gp_Vec normal;
             gp_Pnt center;
@@ -737,27 +922,91 @@ struct DistanceInspection
     std::vector<InspectNominalGeometry*> nominal;
 };
 
-// Helper internal class for QtConcurrent map operation. Holds sums-of-squares and counts for RMS
-// calculation
-class DistanceInspectionRMS
+// Helper internal class for QtConcurrent map operation. Holds the statistics of the distances
+// within the search radius of a block of points, the blocks are merged by operator+=.
+class DistanceInspectionStatistics
 {
 public:
-    DistanceInspectionRMS() = default;
-    DistanceInspectionRMS& operator+=(const DistanceInspectionRMS& rhs)
+    DistanceInspectionStatistics() = default;
+    DistanceInspectionStatistics(float radius, int bins)
+        : m_radius(radius)
+        , m_histogram(std::max(bins, 1), 0)
+    {}
+    void add(float value)
+    {
+        this->m_numv++;
+        this->m_sum += value;
+        this->m_sumsq += value * value;
+        this->m_min = std::min(this->m_min, value);
+        this->m_max = std::max(this->m_max, value);
+
+        auto bins = static_cast<int>(this->m_histogram.size());
+        int bin = bins / 2;
+        if (this->m_radius > 0.0F) {
+            bin = static_cast<int>((value + this->m_radius) / (2.0F * this->m_radius) * bins);
+        }
+        this->m_histogram[std::clamp(bin, 0, bins - 1)]++;
+    }
+    DistanceInspectionStatistics& operator+=(const DistanceInspectionStatistics& rhs)
     {
+        // the result of the reduction is default constructed
+        if (this->m_histogram.empty()) {
+            this->m_radius = rhs.m_radius;
+            this->m_histogram.resize(rhs.m_histogram.size(), 0);
+        }
         this->m_numv += rhs.m_numv;
+        this->m_sum += rhs.m_sum;
         this->m_sumsq += rhs.m_sumsq;
+        this->m_min = std::min(this->m_min, rhs.m_min);
+        this->m_max = std::max(this->m_max, rhs.m_max);
+        for (std::size_t i = 0; i < rhs.m_histogram.size(); i++) {
+            this->m_histogram[i] += rhs.m_histogram[i];
+        }
         return *this;
     }
-    double getRMS()
+    double getMean() const
+    {
+        if (this->m_numv == 0) {
+            return 0.0;
+        }
+        return this->m_sum / (double)this->m_numv;
+    }
+    double getRMS() const
     {
         if (this->m_numv == 0) {
             return 0.0;
         }
         return sqrt(this->m_sumsq / (double)this->m_numv);
     }
-    int m_numv {0};
+    // estimates the distance below which the given percentage of the values are by
+    // interpolating within the bins of the histogram
+    double getPercentile(double percent) const
+    {
+        if (this->m_numv == 0) {
+            return 0.0;
+        }
+
+        double target = percent / 100.0 * double(this->m_numv);
+        double width = 2.0 * this->m_radius / double(this->m_histogram.size());
+        long count = 0;
+        for (std::size_t i = 0; i < this->m_histogram.size(); i++) {
+            long next = count + this->m_histogram[i];
+            if (next >= target && this->m_histogram[i] > 0) {
+                double lower = -this->m_radius + double(i) * width;
+                double value = lower + (target - double(count)) / this->m_histogram[i] * width;
+                return std::clamp<double>(value, this->m_min, this->m_max);
+            }
+            count = next;
+        }
+        return this->m_max;
+    }
+    long m_numv {0};
+    double m_sum {0.0};
     double m_sumsq {0.0};
+    float m_min {std::numeric_limits<float>::max()};
+    float m_max {-std::numeric_limits<float>::max()};
+    float m_radius {0.0F};
+    std::vector<long> m_histogram;
 };
 }  // namespace Inspection
 
@@ -770,6 +1019,33 @@ Feature::Feature()
     ADD_PROPERTY(Actual, (nullptr));
     ADD_PROPERTY(Nominals, (nullptr));
     ADD_PROPERTY(Distances, (0.0));
+    ADD_PROPERTY_TYPE(StoreDistances,
+                      (true),
+                      nullptr,
+                      App::Prop_None,
+                      "Keep the distance of every point, otherwise only compute the statistics");
+    ADD_PROPERTY_TYPE(HistogramBins,
+                      (100),
+                      nullptr,
+                      App::Prop_None,
+                      "Number of bins of the histogram");
+
+    auto output = App::PropertyType(App::Prop_ReadOnly | App::Prop_Output);
+    ADD_PROPERTY_TYPE(Count, (0), "Statistics", output, "Number of points within search radius");
+    ADD_PROPERTY_TYPE(Minimum, (0.0), "Statistics", output, "Minimum distance");
+    ADD_PROPERTY_TYPE(Maximum, (0.0), "Statistics", output, "Maximum distance");
+    ADD_PROPERTY_TYPE(Mean, (0.0), "Statistics", output, "Mean distance");
+    ADD_PROPERTY_TYPE(RMS, (0.0), "Statistics", output, "Root mean square of the distances");
+    ADD_PROPERTY_TYPE(Histogram,
+                      (),
+                      "Statistics",
+                      output,
+                      "Number of points per bin from -SearchRadius to SearchRadius");
+    ADD_PROPERTY_TYPE(Percentiles,
+                      (),
+                      "Statistics",
+                      output,
+                      "Distances below which 1, 5, 25, 50, 75, 95 and 99 percent of points are");
 }
 
 Feature::~Feature() = default;
@@ -788,6 +1064,12 @@ short Feature::mustExecute() const
     if (Nominals.isTouched()) {
         return 1;
     }
+    if (StoreDistances.isTouched()) {
+        return 1;
+    }
+    if (HistogramBins.isTouched()) {
+        return 1;
+    }
     return 0;
 }
 
@@ -833,7 +1115,6 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
@@ -899,70 +1180,84 @@ App::DocumentObjectExecReturn* Feature::execute()
     Base::Console().Message("RMS value for '%s' with search radius [%.4f,%.4f] is: %.4f\n",
         this->Label.getValue(), -this->SearchRadius.getValue(), this->SearchRadius.getValue(), fRMS);
 #else
+    // the points are processed in blocks so that the statistics are merged only once per block
+    const unsigned long blockSize = 4096;
+    const float radius = this->SearchRadius.getValue();
+    const int bins = std::max<int>(this->HistogramBins.getValue(), 1);
+    const bool store = this->StoreDistances.getValue();
+
     unsigned long count = actual->countPoints();
-    std::vector<float> vals(count);
-    std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index) {
-        DistanceInspectionRMS res;
-        Base::Vector3f pnt = actual->getPoint(index);
+    unsigned long blocks = (count + blockSize - 1) / blockSize;
+    std::vector<float> vals(store ? count : 0);
+    std::function<DistanceInspectionStatistics(unsigned long)> fMap = [&](unsigned long block) {
+        DistanceInspectionStatistics res(radius, bins);
+        unsigned long last = std::min(count, (block + 1) * blockSize);
+        for (unsigned long index = block * blockSize; index < last; index++) {
+            Base::Vector3f pnt = actual->getPoint(index);
+
+            float fMinDist = std::numeric_limits<float>::max();
+            for (auto it : inspectNominal) {
+                float fDist = it->getDistance(pnt);
+                if (fabs(fDist) < fabs(fMinDist)) {
+                    fMinDist = fDist;
+                }
+            }
 
-        float fMinDist = std::numeric_limits<float>::max();
-        for (auto it : inspectNominal) {
-            float fDist = it->getDistance(pnt);
-            if (fabs(fDist) < fabs(fMinDist)) {
-                fMinDist = fDist;
+            if (fMinDist > radius) {
+                fMinDist = std::numeric_limits<float>::max();
+            }
+            else if (-fMinDist > radius) {
+                fMinDist = -std::numeric_limits<float>::max();
+            }
+            else {
+                res.add(fMinDist);
             }
-        }
 
-        if (fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = std::numeric_limits<float>::max();
-        }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = -std::numeric_limits<float>::max();
-        }
-        else {
-            res.m_sumsq += fMinDist * fMinDist;
-            res.m_numv++;
+            if (store) {
+                vals[index] = fMinDist;
+            }
         }
-
-        vals[index] = fMinDist;
         return res;
     };
 
-    DistanceInspectionRMS res;
+    DistanceInspectionStatistics res(radius, bins);
 
     if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
+        // Build vector of increasing block indices
+        std::vector<unsigned long> index(blocks);
         std::iota(index.begin(), index.end(), 0);
-        // Perform map-reduce operation : compute distances and update sum of squares for RMS
-        // computation
-        QFuture<DistanceInspectionRMS> future =
-            QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
+        // Perform map-reduce operation : compute distances and merge the statistics of the
+        // blocks
+        QFuture<DistanceInspectionStatistics> future =
+            QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionStatistics::operator+=);
         // Setup progress bar
-        Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
-        QFutureWatcher<DistanceInspectionRMS> watcher;
+        Base::FutureWatcherProgress progress("Inspecting...", blocks);
+        QFutureWatcher<DistanceInspectionStatistics> watcher;
         QObject::connect(&watcher,
-                         &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
+                         &QFutureWatcher<DistanceInspectionStatistics>::progressValueChanged,
                          &progress,
                          &Base::FutureWatcherProgress::progressValueChanged);
         // Keep UI responsive during computation
         QEventLoop loop;
         QObject::connect(&watcher,
-                         &QFutureWatcher<DistanceInspectionRMS>::finished,
+                         &QFutureWatcher<DistanceInspectionStatistics>::finished,
                          &loop,
                          &QEventLoop::quit);
         watcher.setFuture(future);
         loop.exec();
-        res = future.result();
+        if (blocks > 0) {
+            res = future.result();
+        }
     }
     else {
         // Single-threaded operation
         std::stringstream str;
         str << "Inspecting " << this->Label.getValue() << "...";
-        Base::SequencerLauncher seq(str.str().c_str(), count);
+        Base::SequencerLauncher seq(str.str().c_str(), blocks);
 
-        for (unsigned int i = 0; i < count; i++) {
+        for (unsigned long i = 0; i < blocks; i++) {
             res += fMap(i);
+            seq.next();
         }
     }
 
@@ -972,6 +1267,18 @@ App::DocumentObjectExecReturn* Feature::execute()
                             this->SearchRadius.getValue(),
                             res.getRMS());
     Distances.setValues(vals);
+
+    Count.setValue(res.m_numv);
+    Minimum.setValue(res.m_numv > 0 ? res.m_min : 0.0F);
+    Maximum.setValue(res.m_numv > 0 ? res.m_max : 0.0F);
+    Mean.setValue(res.getMean());
+    RMS.setValue(res.getRMS());
+    Histogram.setValues(res.m_histogram);
+    std::vector<double> percentiles;
+    for (double percent : {1.0, 5.0, 25.0, 50.0, 75.0, 95.0, 99.0}) {
+        percentiles.push_back(res.getPercentile(percent));
+    }
+    Percentiles.setValues(percentiles);
 #endif
 
     delete actual;
@@ -23,6 +23,11 @@
 #ifndef INSPECTION_FEATURE_H
 #define INSPECTION_FEATURE_H
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -159,6 +164,9 @@ private:
     Points::PointsGrid* _pGrid;
 };
 
+/** The distances are searched on a tessellation of the shape and only the nearest faces are
+ * checked exactly. getDistance() can be called from several threads at the same time.
+ */
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
@@ -167,12 +175,22 @@ public:
     float getDistance(const Base::Vector3f&) const override;
 
 private:
-    bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    class Tessellation;
+    class ThreadData;
+
+    void tessellate(const TopoDS_Shape&);
+    ThreadData& getThreadData() const;
+    float getShapeDistance(ThreadData&, const gp_Pnt&) const;
+    float getFarDistance(ThreadData&, const Base::Vector3f&, unsigned long facet) const;
+    bool isInsideSolid(ThreadData&, const gp_Pnt&) const;
+    bool isBelowFace(const BRepExtrema_DistShapeShape&, const gp_Pnt&) const;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
     const TopoDS_Shape& _rShape;
+    std::unique_ptr<Tessellation> tessellation;
+    mutable std::mutex threadMutex;
+    mutable std::map<std::thread::id, std::unique_ptr<ThreadData>> threadData;
+    float radius;
     bool isSolid {false};
 };
 
@@ -255,6 +273,24 @@ public:
     App::PropertyLink Actual;
     App::PropertyLinkList Nominals;
     PropertyDistanceList Distances;
+    /// If false the distances of the points are not kept but only the statistics
+    App::PropertyBool StoreDistances;
+    App::PropertyInteger HistogramBins;
+    //@}
+
+    /** @name Statistics
+     * Only the points within the search radius are taken into account.
+     */
+    //@{
+    App::PropertyInteger Count;
+    App::PropertyFloat Minimum;
+    App::PropertyFloat Maximum;
+    App::PropertyFloat Mean;
+    App::PropertyFloat RMS;
+    /// Number of points of equally sized bins from -SearchRadius to SearchRadius
+    App::PropertyIntegerList Histogram;
+    /// Distances below which 1, 5, 25, 50, 75, 95 and 99 percent of the points are
+    App::PropertyFloatList Percentiles;
     //@}
 
     /** @name Actions */
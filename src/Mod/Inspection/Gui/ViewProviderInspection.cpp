@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+
 #include <QApplication>
 #include <QMenu>
 #include <QMessageBox>
@@ -684,6 +686,10 @@ QString ViewProviderInspection::inspectDistance(const SoPickedPoint* pp) const
             int index1 = facedetail->getPoint(0)->getCoordinateIndex();
             int index2 = facedetail->getPoint(1)->getCoordinateIndex();
             int index3 = facedetail->getPoint(2)->getCoordinateIndex();
+            // the distances are not stored if only the statistics are computed
+            if (std::max({index1, index2, index3}) >= dist->getSize()) {
+                return info;
+            }
             float fVal1 = (*dist)[index1];
             float fVal2 = (*dist)[index2];
             float fVal3 = (*dist)[index3];
@@ -732,8 +738,10 @@ QString ViewProviderInspection::inspectDistance(const SoPickedPoint* pp) const
         if (prop && prop->is<Inspection::PropertyDistanceList>()) {
             Inspection::PropertyDistanceList* dist =
                 static_cast<Inspection::PropertyDistanceList*>(prop);
-            float fVal = (*dist)[index];
-            info = QObject::tr("Distance: %1").arg(fVal);
+            if (index < dist->getSize()) {
+                float fVal = (*dist)[index];
+                info = QObject::tr("Distance: %1").arg(fVal);
+            }
         }
     }
 
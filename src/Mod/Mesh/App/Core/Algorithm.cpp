@@ -25,6 +25,8 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <limits>
+#include <numeric>
+#include <thread>
 #endif
 
 #include <Base/Console.h>
@@ -32,7 +34,9 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
 #include "Elements.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "Triangulation.h"
@@ -117,6 +121,42 @@ bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
     return bSol;
 }
 
+bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                      const Base::Vector3f& rclDir,
+                                      float fMaxAngle,
+                                      const MeshFacetBVH& rclBVH,
+                                      Base::Vector3f& rclRes,
+                                      FacetIndex& rulFacet) const
+{
+    Base::Vector3f clProj;
+    Base::Vector3f clRes;
+    bool bSol = false;
+    FacetIndex ulInd = 0;
+
+    // keep the order of the facets so that the same facet as without hierarchy is found
+    std::vector<FacetIndex> aulFacets;
+    rclBVH.OnLine(rclPt, rclDir, aulFacets);
+    std::sort(aulFacets.begin(), aulFacets.end());
+
+    for (FacetIndex index : aulFacets) {
+        MeshGeomFacet rclSFacet = _rclMesh.GetFacet(index);
+        if (rclSFacet.Foraminate(rclPt, rclDir, clRes, fMaxAngle)) {
+            if (!bSol || (clRes - rclPt).Length() < (clProj - rclPt).Length()) {
+                bSol = true;
+                clProj = clRes;
+                ulInd = index;
+            }
+        }
+    }
+
+    if (bSol) {
+        rclRes = clProj;
+        rulFacet = ulInd;
+    }
+
+    return bSol;
+}
+
 bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
                                       const Base::Vector3f& rclDir,
                                       const MeshFacetGrid& rclGrid,
@@ -2108,6 +2148,73 @@ void MeshRefPointToPoints::RemoveNeighbour(PointIndex pos, PointIndex facet)
 
 //----------------------------------------------------------------------------
 
+void MeshPointAdjacency::Rebuild()
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    std::size_t numPoints = _rclMesh.CountPoints();
+
+    // the facets of each point, the counting sort keeps them in ascending order
+    _facetOffsets.assign(numPoints + 1, 0);
+    for (const auto& facet : rFacets) {
+        for (PointIndex point : facet._aulPoints) {
+            _facetOffsets[point + 1]++;
+        }
+    }
+    std::partial_sum(_facetOffsets.begin(), _facetOffsets.end(), _facetOffsets.begin());
+    _facets.resize(_facetOffsets.back());
+    std::vector<std::size_t> cursor(_facetOffsets.begin(), _facetOffsets.end() - 1);
+    for (FacetIndex index = 0; index < rFacets.size(); index++) {
+        for (PointIndex point : rFacets[index]._aulPoints) {
+            _facets[cursor[point]++] = index;
+        }
+    }
+
+    // the neighbour points are determined twice, first to get the size of each row and then
+    // to fill it
+    auto collect = [this, &rFacets](PointIndex pos, std::vector<PointIndex>& row) {
+        row.clear();
+        for (FacetIndex index : GetFacets(pos)) {
+            for (PointIndex point : rFacets[index]._aulPoints) {
+                if (point != pos) {
+                    row.push_back(point);
+                }
+            }
+        }
+        std::sort(row.begin(), row.end());
+        row.erase(std::unique(row.begin(), row.end()), row.end());
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    _pointOffsets.assign(numPoints + 1, 0);
+    MeshCore::parallel_for(
+        std::size_t(0),
+        numPoints,
+        [&](std::size_t first, std::size_t last) {
+            std::vector<PointIndex> row;
+            for (std::size_t pos = first; pos < last; pos++) {
+                collect(pos, row);
+                _pointOffsets[pos + 1] = row.size();
+            }
+        },
+        threads);
+    std::partial_sum(_pointOffsets.begin(), _pointOffsets.end(), _pointOffsets.begin());
+
+    _points.resize(_pointOffsets.back());
+    MeshCore::parallel_for(
+        std::size_t(0),
+        numPoints,
+        [&](std::size_t first, std::size_t last) {
+            std::vector<PointIndex> row;
+            for (std::size_t pos = first; pos < last; pos++) {
+                collect(pos, row);
+                std::copy(row.begin(), row.end(), _points.begin() + _pointOffsets[pos]);
+            }
+        },
+        threads);
+}
+
+//----------------------------------------------------------------------------
+
 void MeshRefEdgeToFacets::Rebuild()
 {
     _map.clear();
@@ -46,6 +46,7 @@ class MeshGeomFacet;
 class MeshGeomEdge;
 class MeshKernel;
 class MeshFacetGrid;
+class MeshFacetBVH;
 class MeshFacetArray;
 class MeshRefPointToFacets;
 class AbstractPolygonTriangulator;
@@ -86,6 +87,16 @@ public:
                            float fMaxAngle,
                            Base::Vector3f& rclRes,
                            FacetIndex& rulFacet) const;
+    /**
+     * Does the same as the above method but only tests the facets whose bounding boxes are
+     * hit by the ray. The hierarchy \a rclBVH must be built for the attached mesh.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           float fMaxAngle,
+                           const MeshFacetBVH& rclBVH,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
     /**
      * Searches for the nearest facet to the ray defined by
      * (\a rclPt, \a rclDir).
@@ -566,6 +577,72 @@ private:
     std::vector<std::set<PointIndex>> _map;
 };
 
+/**
+ * The MeshPointAdjacency class gives access to the neighbour points and the facets of each
+ * point like MeshRefPointToPoints and MeshRefPointToFacets do. Instead of a set per point the
+ * indices are stored in flat arrays in compressed-row layout which needs much less memory and
+ * is faster to traverse. The neighbour points are collected on several threads.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshPointAdjacency
+{
+public:
+    /// The indices of one point in ascending order
+    template<class Index>
+    class Row
+    {
+    public:
+        Row(const Index* first, const Index* last)
+            : _first(first)
+            , _last(last)
+        {}
+        const Index* begin() const
+        {
+            return _first;
+        }
+        const Index* end() const
+        {
+            return _last;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(_last - _first);
+        }
+
+    private:
+        const Index* _first;
+        const Index* _last;
+    };
+
+    /// Construction
+    explicit MeshPointAdjacency(const MeshKernel& rclM)
+        : _rclMesh(rclM)
+    {
+        Rebuild();
+    }
+
+    /// Rebuilds up data structure
+    void Rebuild();
+    /// Returns the points that share an edge with the point \a pos.
+    Row<PointIndex> GetPoints(PointIndex pos) const
+    {
+        return {_points.data() + _pointOffsets[pos], _points.data() + _pointOffsets[pos + 1]};
+    }
+    /// Returns the facets that reference the point \a pos.
+    Row<FacetIndex> GetFacets(PointIndex pos) const
+    {
+        return {_facets.data() + _facetOffsets[pos], _facets.data() + _facetOffsets[pos + 1]};
+    }
+
+private:
+    const MeshKernel& _rclMesh; /**< The mesh kernel. */
+    std::vector<std::size_t> _pointOffsets;
+    std::vector<PointIndex> _points;
+    std::vector<std::size_t> _facetOffsets;
+    std::vector<FacetIndex> _facets;
+};
+
 /**
  * The MeshRefEdgeToFacets builds up a structure to have access to all facets
  * of an edge. On a manifold mesh an edge has one or two facets associated.
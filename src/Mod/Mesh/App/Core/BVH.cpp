@@ -0,0 +1,419 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2025 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#endif
+
+#include "BVH.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// maximum number of facets of a leaf
+constexpr std::size_t LeafSize = 4;
+// number of tasks the traversal is split into, it doesn't depend on the number of
+// threads so that the order of the results is always the same
+constexpr std::size_t TaskCount = 256;
+
+// slab test of the infinite line through base with direction dir against the box enlarged by eps
+bool IntersectsLine(const Base::BoundBox3f& box,
+                    const Base::Vector3f& base,
+                    const Base::Vector3f& dir,
+                    float eps)
+{
+    const float minimum[3] = {box.MinX - eps, box.MinY - eps, box.MinZ - eps};
+    const float maximum[3] = {box.MaxX + eps, box.MaxY + eps, box.MaxZ + eps};
+    float tmin = -std::numeric_limits<float>::max();
+    float tmax = std::numeric_limits<float>::max();
+    for (int i = 0; i < 3; i++) {
+        if (dir[i] == 0.0F) {
+            if (base[i] < minimum[i] || base[i] > maximum[i]) {
+                return false;
+            }
+            continue;
+        }
+        float t1 = (minimum[i] - base[i]) / dir[i];
+        float t2 = (maximum[i] - base[i]) / dir[i];
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+        if (tmin > tmax) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float DistanceToBox(const Base::BoundBox3f& box, const Base::Vector3f& point)
+{
+    float dx = std::max({box.MinX - point.x, 0.0F, point.x - box.MaxX});
+    float dy = std::max({box.MinY - point.y, 0.0F, point.y - box.MaxY});
+    float dz = std::max({box.MinZ - point.z, 0.0F, point.z - box.MaxZ});
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+}  // namespace
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& mesh)
+    : _mesh(mesh)
+{
+    Rebuild();
+}
+
+void MeshFacetBVH::Rebuild()
+{
+    const MeshFacetArray& rFacets = _mesh.GetFacets();
+    const MeshPointArray& rPoints = _mesh.GetPoints();
+    std::size_t count = rFacets.size();
+
+    _boxes.resize(count);
+    std::vector<Base::Vector3f> centers(count);
+    MeshCore::parallel_for(
+        std::size_t(0),
+        count,
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; i++) {
+                const MeshFacet& rFace = rFacets[i];
+                Base::BoundBox3f box;
+                box.Add(rPoints[rFace._aulPoints[0]]);
+                box.Add(rPoints[rFace._aulPoints[1]]);
+                box.Add(rPoints[rFace._aulPoints[2]]);
+                _boxes[i] = box;
+                centers[i] = box.GetCenter();
+            }
+        },
+        int(std::thread::hardware_concurrency()));
+
+    _facets.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        _facets[i] = i;
+    }
+
+    _nodes.clear();
+    if (count > 0) {
+        _nodes.reserve(2 * count / LeafSize + 1);
+        Build(0, count, centers);
+    }
+}
+
+void MeshFacetBVH::Build(std::size_t first,
+                         std::size_t last,
+                         const std::vector<Base::Vector3f>& centers)
+{
+    Node node;
+    Base::BoundBox3f centerBox;
+    for (std::size_t i = first; i < last; i++) {
+        node.box.Add(_boxes[_facets[i]]);
+        centerBox.Add(centers[_facets[i]]);
+    }
+
+    std::size_t index = _nodes.size();
+    if (last - first <= LeafSize) {
+        node.first = first;
+        node.count = last - first;
+        _nodes.push_back(node);
+        return;
+    }
+
+    _nodes.push_back(node);
+
+    // split at the median of the facet centers along the longest axis
+    int axis = 0;
+    if (centerBox.LengthY() > centerBox.LengthX()) {
+        axis = 1;
+    }
+    if (centerBox.LengthZ() > std::max(centerBox.LengthX(), centerBox.LengthY())) {
+        axis = 2;
+    }
+
+    std::size_t mid = first + (last - first) / 2;
+    std::nth_element(_facets.begin() + first,
+                     _facets.begin() + mid,
+                     _facets.begin() + last,
+                     [&centers, axis](FacetIndex f1, FacetIndex f2) {
+                         return centers[f1][axis] < centers[f2][axis];
+                     });
+
+    Build(first, mid, centers);
+    _nodes[index].first = _nodes.size();
+    Build(mid, last, centers);
+}
+
+Base::BoundBox3f MeshFacetBVH::GetBoundBox() const
+{
+    if (_nodes.empty()) {
+        return Base::BoundBox3f();
+    }
+    return _nodes.front().box;
+}
+
+void MeshFacetBVH::Inside(const Base::BoundBox3f& box, std::vector<FacetIndex>& facets) const
+{
+    if (_nodes.empty()) {
+        return;
+    }
+
+    std::vector<std::size_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        std::size_t index = stack.back();
+        stack.pop_back();
+        if (!(node.box && box)) {
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                if (_boxes[_facets[i]] && box) {
+                    facets.push_back(_facets[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first);
+            stack.push_back(index + 1);
+        }
+    }
+}
+
+void MeshFacetBVH::OnLine(const Base::Vector3f& base,
+                          const Base::Vector3f& dir,
+                          std::vector<FacetIndex>& facets) const
+{
+    if (_nodes.empty()) {
+        return;
+    }
+
+    // make sure that facets touched by the line are not missed due to rounding errors
+    const float eps = 1.0e-5F * _nodes.front().box.CalcDiagonalLength();
+    std::vector<std::size_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        std::size_t index = stack.back();
+        stack.pop_back();
+        if (!IntersectsLine(node.box, base, dir, eps)) {
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                if (IntersectsLine(_boxes[_facets[i]], base, dir, eps)) {
+                    facets.push_back(_facets[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first);
+            stack.push_back(index + 1);
+        }
+    }
+}
+
+FacetIndex
+MeshFacetBVH::NearestFacet(const Base::Vector3f& point, float maxDistance, float& distance) const
+{
+    FacetIndex nearest = FACET_INDEX_MAX;
+    if (_nodes.empty()) {
+        return nearest;
+    }
+
+    float minDist = maxDistance;
+    std::vector<std::size_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        std::size_t index = stack.back();
+        stack.pop_back();
+        if (DistanceToBox(node.box, point) > minDist) {
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                if (DistanceToBox(_boxes[_facets[i]], point) > minDist) {
+                    continue;
+                }
+                float dist = _mesh.GetFacet(_facets[i]).DistanceToPoint(point);
+                if (dist <= minDist) {
+                    minDist = dist;
+                    nearest = _facets[i];
+                }
+            }
+        }
+        else {
+            // visit the nearer child first so that the bound shrinks quickly
+            std::size_t left = index + 1;
+            std::size_t right = node.first;
+            if (DistanceToBox(_nodes[left].box, point) < DistanceToBox(_nodes[right].box, point)) {
+                std::swap(left, right);
+            }
+            stack.push_back(left);
+            stack.push_back(right);
+        }
+    }
+
+    if (nearest != FACET_INDEX_MAX) {
+        distance = minDist;
+    }
+    return nearest;
+}
+
+void MeshFacetBVH::Split(const MeshFacetBVH& other,
+                         const Task& task,
+                         std::vector<Task>& tasks) const
+{
+    const Node& node1 = _nodes[task.node1];
+    const Node& node2 = other._nodes[task.node2];
+
+    if (&other == this && task.node1 == task.node2) {
+        // the facets of an inner node are checked within both children and across them
+        std::size_t left = task.node1 + 1;
+        std::size_t right = node1.first;
+        tasks.push_back({left, left});
+        if (_nodes[left].box && _nodes[right].box) {
+            tasks.push_back({left, right});
+        }
+        tasks.push_back({right, right});
+        return;
+    }
+
+    // descend into the larger node
+    bool split1 = node2.IsLeaf()
+        || (!node1.IsLeaf()
+            && node1.box.CalcDiagonalLength() >= node2.box.CalcDiagonalLength());
+    if (split1) {
+        std::size_t left = task.node1 + 1;
+        std::size_t right = node1.first;
+        if (_nodes[left].box && node2.box) {
+            tasks.push_back({left, task.node2});
+        }
+        if (_nodes[right].box && node2.box) {
+            tasks.push_back({right, task.node2});
+        }
+    }
+    else {
+        std::size_t left = task.node2 + 1;
+        std::size_t right = node2.first;
+        if (node1.box && other._nodes[left].box) {
+            tasks.push_back({task.node1, left});
+        }
+        if (node1.box && other._nodes[right].box) {
+            tasks.push_back({task.node1, right});
+        }
+    }
+}
+
+std::vector<MeshFacetBVH::Task> MeshFacetBVH::CreateTasks(const MeshFacetBVH& other) const
+{
+    std::vector<Task> tasks;
+    if (_nodes.empty() || other._nodes.empty() || !(_nodes[0].box && other._nodes[0].box)) {
+        return tasks;
+    }
+
+    // split the tasks level by level until there are enough of them
+    tasks.push_back({0, 0});
+    bool splitted = true;
+    while (splitted && tasks.size() < TaskCount) {
+        splitted = false;
+        std::vector<Task> next;
+        next.reserve(4 * tasks.size());
+        for (const auto& it : tasks) {
+            if (_nodes[it.node1].IsLeaf() && other._nodes[it.node2].IsLeaf()) {
+                next.push_back(it);
+            }
+            else {
+                Split(other, it, next);
+                splitted = true;
+            }
+        }
+        tasks.swap(next);
+    }
+
+    return tasks;
+}
+
+bool MeshFacetBVH::Visit(const MeshFacetBVH& other,
+                         const Task& task,
+                         const PairVisitor& visit) const
+{
+    bool self = &other == this;
+    std::vector<Task> stack;
+    stack.push_back(task);
+    while (!stack.empty()) {
+        Task top = stack.back();
+        stack.pop_back();
+
+        const Node& node1 = _nodes[top.node1];
+        const Node& node2 = other._nodes[top.node2];
+        if (node1.IsLeaf() && node2.IsLeaf()) {
+            if (!VisitLeaves(other, node1, node2, self && top.node1 == top.node2, visit)) {
+                return false;
+            }
+        }
+        else {
+            // keep the order of a depth-first traversal
+            std::size_t size = stack.size();
+            Split(other, top, stack);
+            std::reverse(stack.begin() + size, stack.end());
+        }
+    }
+
+    return true;
+}
+
+bool MeshFacetBVH::VisitLeaves(const MeshFacetBVH& other,
+                               const Node& node1,
+                               const Node& node2,
+                               bool sameNode,
+                               const PairVisitor& visit) const
+{
+    bool self = &other == this;
+    for (std::size_t i = node1.first; i < node1.first + node1.count; i++) {
+        FacetIndex index1 = _facets[i];
+        const Base::BoundBox3f& box1 = _boxes[index1];
+        std::size_t start = sameNode ? i + 1 : node2.first;
+        for (std::size_t j = start; j < node2.first + node2.count; j++) {
+            FacetIndex index2 = other._facets[j];
+            if (!(box1 && other._boxes[index2])) {
+                continue;
+            }
+
+            bool ok = self ? visit(std::min(index1, index2), std::max(index1, index2))
+                           : visit(index1, index2);
+            if (!ok) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2025 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Sequencer.h>
+
+#include "Functional.h"
+#include "MeshKernel.h"
+
+namespace MeshCore
+{
+
+/**
+ * The MeshFacetBVH class is a bounding volume hierarchy over the axis-aligned bounding
+ * boxes of the facets of a mesh. Unlike the MeshFacetGrid it adapts to the distribution
+ * of the facets, so that dense regions or long thin parts don't end up in a few overfull
+ * cells. The nodes are stored in a flat array in depth-first order.
+ *
+ * The hierarchy keeps a reference to the mesh and must be rebuilt when the mesh changes.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    /// A pair of nodes whose facets are checked against each other by one task
+    struct Task
+    {
+        std::size_t node1, node2;
+    };
+    /// Return false to stop the traversal
+    using PairVisitor = std::function<bool(FacetIndex, FacetIndex)>;
+
+    /// Builds the hierarchy of the facets of \a mesh.
+    explicit MeshFacetBVH(const MeshKernel& mesh);
+
+    /// Rebuilds the hierarchy after the mesh has been modified.
+    void Rebuild();
+    const MeshKernel& GetMesh() const
+    {
+        return _mesh;
+    }
+    /// Returns the bounding box of the given facet.
+    const Base::BoundBox3f& GetBoundBox(FacetIndex index) const
+    {
+        return _boxes[index];
+    }
+    /// Returns the bounding box of all facets.
+    Base::BoundBox3f GetBoundBox() const;
+    std::size_t CountNodes() const
+    {
+        return _nodes.size();
+    }
+    /// Returns the indices of all facets whose bounding boxes intersect \a box.
+    void Inside(const Base::BoundBox3f& box, std::vector<FacetIndex>& facets) const;
+    /// Returns the indices of all facets whose bounding boxes are hit by the infinite line
+    /// through \a base with direction \a dir.
+    void OnLine(const Base::Vector3f& base,
+                const Base::Vector3f& dir,
+                std::vector<FacetIndex>& facets) const;
+    /// Returns the facet nearest to \a point that is not farther away than \a maxDistance
+    /// and sets \a distance, or returns FACET_INDEX_MAX if there is no such facet.
+    FacetIndex
+    NearestFacet(const Base::Vector3f& point, float maxDistance, float& distance) const;
+
+    /**
+     * Calls \a test for every pair of different facets with overlapping bounding boxes. For
+     * a hierarchy of the same mesh every pair is visited once with the lower index first,
+     * otherwise the first index refers to this mesh and the second to \a other.
+     * If \a test returns true it has filled in a result that is collected. With \a stopAtFirst
+     * the traversal stops after the first collected result.
+     * The traversal is split into independent tasks that run on up to \a threads threads, so
+     * \a test must be thread-safe. The results are returned in an order that doesn't depend
+     * on the number of threads.
+     * The tasks are run in rounds of a few tasks per thread. The sequencer with the text
+     * \a progress advances on the calling thread for every finished block of tasks, so that
+     * the user can abort the traversal.
+     */
+    template<class Result>
+    std::vector<Result>
+    CollectPairs(const MeshFacetBVH& other,
+                 const std::function<bool(FacetIndex, FacetIndex, Result&)>& test,
+                 bool stopAtFirst,
+                 int threads,
+                 const char* progress) const
+    {
+        std::vector<Task> tasks = CreateTasks(other);
+        std::vector<std::vector<Result>> results(tasks.size());
+        std::atomic<bool> stop {false};
+
+        const std::size_t blocks = std::max(threads, 1);
+        const std::size_t roundSize = TasksPerBlock * blocks;
+        std::size_t steps = 0;
+        for (std::size_t first = 0; first < tasks.size(); first += roundSize) {
+            steps += std::min(blocks, tasks.size() - first);
+        }
+
+        Base::SequencerLauncher seq(progress, steps);
+        for (std::size_t first = 0; first < tasks.size() && !stop; first += roundSize) {
+            MeshCore::parallel_for(
+                first,
+                std::min(first + roundSize, tasks.size()),
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end && !stop; i++) {
+                        std::vector<Result>& found = results[i];
+                        Visit(other, tasks[i], [&](FacetIndex index1, FacetIndex index2) {
+                            Result res;
+                            if (test(index1, index2, res)) {
+                                found.push_back(res);
+                                if (stopAtFirst) {
+                                    stop = true;
+                                }
+                            }
+                            return !stop.load(std::memory_order_relaxed);
+                        });
+                    }
+                },
+                threads,
+                [&seq]() {
+                    seq.next(true);
+                });
+        }
+
+        std::vector<Result> all;
+        for (auto& it : results) {
+            all.insert(all.end(), it.begin(), it.end());
+        }
+        return all;
+    }
+
+    /// Splits the traversal of the overlapping facets into independent tasks.
+    std::vector<Task> CreateTasks(const MeshFacetBVH& other) const;
+    /// Calls \a visit for every pair of facets with overlapping boxes of the given task.
+    bool Visit(const MeshFacetBVH& other, const Task& task, const PairVisitor& visit) const;
+
+private:
+    // number of tasks a thread runs per round of CollectPairs()
+    static constexpr std::size_t TasksPerBlock = 4;
+
+    struct Node
+    {
+        Base::BoundBox3f box;
+        // index of the first facet in _facets for a leaf, index of the right child otherwise
+        std::size_t first {0};
+        // number of facets of a leaf, 0 for inner nodes
+        std::size_t count {0};
+        bool IsLeaf() const
+        {
+            return count > 0;
+        }
+    };
+
+    void Build(std::size_t first, std::size_t last, const std::vector<Base::Vector3f>& centers);
+    void Split(const MeshFacetBVH& other, const Task& task, std::vector<Task>& tasks) const;
+    bool VisitLeaves(const MeshFacetBVH& other,
+                     const Node& node1,
+                     const Node& node2,
+                     bool sameNode,
+                     const PairVisitor& visit) const;
+
+private:
+    const MeshKernel& _mesh;
+    std::vector<Base::BoundBox3f> _boxes;
+    std::vector<FacetIndex> _facets;
+    std::vector<Node> _nodes;
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_BVH_H
@@ -24,6 +24,8 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <thread>
+#include <vector>
 #endif
 
 #include <Base/Exception.h>
@@ -358,45 +360,114 @@ void MeshFastBuilder::AddFacet(const MeshGeomFacet& facetPoints)
     }
 }
 
+void MeshFastBuilder::AddFacets(const Base::Vector3f* facetPoints, size_type ctFacets)
+{
+    QVector<Private::Vertex>& verts = p->verts;
+    std::size_t offset = verts.size();
+    std::size_t ctPoints = 3 * std::size_t(ctFacets);
+    verts.resize(QVector<Private::Vertex>::size_type(offset + ctPoints));
+    Private::Vertex* data = verts.data() + offset;
+
+    MeshCore::parallel_for(
+        std::size_t(0),
+        ctPoints,
+        [data, facetPoints](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                const Base::Vector3f& pnt = facetPoints[i];
+                data[i] = Private::Vertex(pnt.x, pnt.y, pnt.z);
+            }
+        },
+        int(std::thread::hardware_concurrency()));
+}
+
 void MeshFastBuilder::Finish()
 {
     using size_type = QVector<Private::Vertex>::size_type;
     QVector<Private::Vertex>& verts = p->verts;
     size_type ulCtPts = verts.size();
-    for (size_type i = 0; i < ulCtPts; ++i) {
-        verts[i].i = i;
-    }
+    Private::Vertex* data = verts.data();
+    int threads = int(std::thread::hardware_concurrency());
+
+    MeshCore::parallel_for(
+        size_type(0),
+        ulCtPts,
+        [data](size_type first, size_type last) {
+            for (size_type i = first; i < last; ++i) {
+                data[i].i = i;
+            }
+        },
+        threads);
 
     // std::sort(verts.begin(), verts.end());
-    int threads = int(std::thread::hardware_concurrency());
     MeshCore::parallel_sort(verts.begin(), verts.end(), std::less<>(), threads);
 
-    QVector<FacetIndex> indices(ulCtPts);
-
-    size_type vertex_count = 0;
-    for (QVector<Private::Vertex>::iterator v = verts.begin(); v != verts.end(); ++v) {
-        if (!vertex_count || *v != verts[vertex_count - 1]) {
-            verts[vertex_count++] = *v;
-        }
+    // Weld equal vertices. The sorted array is split into blocks, first the number of
+    // distinct vertices per block is counted to get the offset of each block in the
+    // point array, then the blocks are written independently.
+    size_type blocks = std::max(std::min(size_type(threads), ulCtPts), size_type(1));
+    auto blockBegin = [ulCtPts, blocks](size_type block) {
+        return ulCtPts * block / blocks;
+    };
+    auto isNewVertex = [data](size_type i) {
+        return i == 0 || data[i] != data[i - 1];
+    };
 
-        indices[v->i] = static_cast<FacetIndex>(vertex_count - 1);
+    std::vector<size_type> offsets(blocks + 1, 0);
+    MeshCore::parallel_for(
+        size_type(0),
+        blocks,
+        [&](size_type first, size_type last) {
+            for (size_type block = first; block < last; ++block) {
+                size_type count = 0;
+                for (size_type i = blockBegin(block); i < blockBegin(block + 1); ++i) {
+                    if (isNewVertex(i)) {
+                        ++count;
+                    }
+                }
+                offsets[block + 1] = count;
+            }
+        },
+        threads);
+    for (size_type block = 0; block < blocks; ++block) {
+        offsets[block + 1] += offsets[block];
     }
 
-    size_type ulCt = verts.size() / 3;
-    MeshFacetArray rFacets(static_cast<FacetIndex>(ulCt));
-    for (size_type i = 0; i < ulCt; ++i) {
-        rFacets[static_cast<size_t>(i)]._aulPoints[0] = indices[3 * i];
-        rFacets[static_cast<size_t>(i)]._aulPoints[1] = indices[3 * i + 1];
-        rFacets[static_cast<size_t>(i)]._aulPoints[2] = indices[3 * i + 2];
-    }
+    size_type vertex_count = offsets[blocks];
+    std::vector<FacetIndex> indices(static_cast<size_t>(ulCtPts));
+    MeshPointArray rPoints(static_cast<PointIndex>(vertex_count));
+    MeshCore::parallel_for(
+        size_type(0),
+        blocks,
+        [&](size_type first, size_type last) {
+            for (size_type block = first; block < last; ++block) {
+                size_type index = offsets[block];
+                for (size_type i = blockBegin(block); i < blockBegin(block + 1); ++i) {
+                    const Private::Vertex& v = data[i];
+                    if (isNewVertex(i)) {
+                        rPoints[static_cast<size_t>(index++)].Set(v.x, v.y, v.z);
+                    }
+                    indices[static_cast<size_t>(v.i)] = static_cast<FacetIndex>(index - 1);
+                }
+            }
+        },
+        threads);
 
-    verts.resize(vertex_count);
+    verts.clear();
 
-    MeshPointArray rPoints;
-    rPoints.reserve(static_cast<size_t>(vertex_count));
-    for (const auto& v : verts) {
-        rPoints.push_back(MeshPoint(v.x, v.y, v.z));
-    }
+    size_type ulCt = ulCtPts / 3;
+    MeshFacetArray rFacets(static_cast<FacetIndex>(ulCt));
+    MeshCore::parallel_for(
+        size_type(0),
+        ulCt,
+        [&rFacets, &indices](size_type first, size_type last) {
+            for (size_type i = first; i < last; ++i) {
+                MeshFacet& face = rFacets[static_cast<size_t>(i)];
+                face._aulPoints[0] = indices[static_cast<size_t>(3 * i)];
+                face._aulPoints[1] = indices[static_cast<size_t>(3 * i + 1)];
+                face._aulPoints[2] = indices[static_cast<size_t>(3 * i + 2)];
+            }
+        },
+        threads);
 
     _meshKernel.Adopt(rPoints, rFacets, true);
 }
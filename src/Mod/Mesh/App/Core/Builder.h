@@ -218,6 +218,10 @@ public:
     /** Add new facet
      */
     void AddFacet(const MeshGeomFacet& facetPoints);
+    /** Add \a ctFacets new facets whose points are stored consecutively, three per facet.
+     * The points are copied in parallel.
+     */
+    void AddFacets(const Base::Vector3f* facetPoints, size_type ctFacets);
 
     /** Finishes building up the mesh structure. Must be done after adding facets.
      */
@@ -22,9 +22,15 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <limits>
+#include <thread>
 #endif
 
+#include <Base/Sequencer.h>
+
 #include "Decimation.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
@@ -32,6 +38,181 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// maximum number of facets of a partition
+constexpr std::size_t PartitionSize = 100000;
+
+// Result of the simplification of a part of the mesh
+struct SimplifiedPart
+{
+    std::vector<Base::Vector3f> points;
+    // index of the point in the original mesh for locked points, POINT_INDEX_MAX otherwise
+    std::vector<PointIndex> indices;
+    // facets referring to the local points
+    std::vector<MeshFacet> facets;
+};
+
+// Splits the facets at the median of the longest axis of their centers until each part has
+// at most PartitionSize facets
+void Partition(std::vector<FacetIndex>::iterator first,
+               std::vector<FacetIndex>::iterator last,
+               const std::vector<Base::Vector3f>& centers,
+               std::vector<std::vector<FacetIndex>>& parts)
+{
+    std::size_t count = std::distance(first, last);
+    if (count <= PartitionSize) {
+        parts.emplace_back(first, last);
+        return;
+    }
+
+    Base::BoundBox3f box;
+    for (auto it = first; it != last; ++it) {
+        box.Add(centers[*it]);
+    }
+    int axis = 0;
+    if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+        axis = 1;
+    }
+    else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+        axis = 2;
+    }
+
+    auto middle = first + count / 2;
+    std::nth_element(first, middle, last, [&centers, axis](FacetIndex f1, FacetIndex f2) {
+        return centers[f1][axis] < centers[f2][axis];
+    });
+    Partition(first, middle, centers, parts);
+    Partition(middle, last, centers, parts);
+}
+
+SimplifiedPart SimplifyPart(const MeshKernel& kernel,
+                            const std::vector<FacetIndex>& part,
+                            const std::vector<char>& locked,
+                            int targetSize,
+                            double maxError)
+{
+    const MeshPointArray& rPoints = kernel.GetPoints();
+    const MeshFacetArray& rFacets = kernel.GetFacets();
+
+    std::vector<PointIndex> points;
+    points.reserve(3 * part.size());
+    for (FacetIndex index : part) {
+        const MeshFacet& facet = rFacets[index];
+        points.insert(points.end(), facet._aulPoints, facet._aulPoints + 3);
+    }
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+
+    Simplify alg;
+    alg.max_error = maxError;
+    alg.vertices.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        Simplify::Vertex v;
+        v.tstart = 0;
+        v.tcount = 0;
+        v.border = 0;
+        v.p = rPoints[points[i]];
+        v.locked = locked[points[i]];
+        v.id = static_cast<int>(i);
+        alg.vertices.push_back(v);
+    }
+
+    alg.triangles.reserve(part.size());
+    for (FacetIndex index : part) {
+        Simplify::Triangle t;
+        t.deleted = 0;
+        t.dirty = 0;
+        for (double& j : t.err) {
+            j = 0.0;
+        }
+        for (int j = 0; j < 3; j++) {
+            PointIndex point = rFacets[index]._aulPoints[j];
+            t.v[j] = static_cast<int>(std::lower_bound(points.begin(), points.end(), point)
+                                      - points.begin());
+        }
+        alg.triangles.push_back(t);
+    }
+
+    alg.simplify_mesh(targetSize, std::numeric_limits<float>::max());
+
+    SimplifiedPart result;
+    result.points.reserve(alg.vertices.size());
+    result.indices.reserve(alg.vertices.size());
+    for (const auto& vertex : alg.vertices) {
+        result.points.push_back(vertex.p);
+        result.indices.push_back(vertex.locked ? points[vertex.id] : POINT_INDEX_MAX);
+    }
+    result.facets.reserve(alg.triangles.size());
+    for (const auto& triangle : alg.triangles) {
+        result.facets.emplace_back(triangle.v[0], triangle.v[1], triangle.v[2]);
+    }
+    return result;
+}
+
+// Replaces the facets of the parts with their simplified version. The points of the new
+// mesh that were locked in any part are marked in \a seam.
+void Stitch(MeshKernel& kernel,
+            const std::vector<std::vector<FacetIndex>>& parts,
+            const std::vector<SimplifiedPart>& results,
+            std::vector<char>& seam)
+{
+    const MeshPointArray& rPoints = kernel.GetPoints();
+    const MeshFacetArray& rFacets = kernel.GetFacets();
+
+    std::vector<char> simplified(rFacets.size(), 0);
+    for (const auto& part : parts) {
+        for (FacetIndex index : part) {
+            simplified[index] = 1;
+        }
+    }
+
+    MeshPointArray points;
+    MeshFacetArray facets;
+    std::vector<PointIndex> mapping(rPoints.size(), POINT_INDEX_MAX);
+    auto mapPoint = [&](PointIndex index) {
+        if (mapping[index] == POINT_INDEX_MAX) {
+            mapping[index] = points.size();
+            points.push_back(rPoints[index]);
+        }
+        return mapping[index];
+    };
+
+    for (std::size_t i = 0; i < rFacets.size(); i++) {
+        if (!simplified[i]) {
+            const MeshFacet& facet = rFacets[i];
+            facets.emplace_back(mapPoint(facet._aulPoints[0]),
+                                mapPoint(facet._aulPoints[1]),
+                                mapPoint(facet._aulPoints[2]));
+        }
+    }
+
+    seam.clear();
+    for (const auto& result : results) {
+        std::vector<PointIndex> local(result.points.size());
+        for (std::size_t i = 0; i < result.points.size(); i++) {
+            if (result.indices[i] != POINT_INDEX_MAX) {
+                local[i] = mapPoint(result.indices[i]);
+                seam.resize(points.size(), 0);
+                seam[local[i]] = 1;
+            }
+            else {
+                local[i] = points.size();
+                points.push_back(MeshPoint(result.points[i]));
+            }
+        }
+        for (const auto& facet : result.facets) {
+            facets.emplace_back(local[facet._aulPoints[0]],
+                                local[facet._aulPoints[1]],
+                                local[facet._aulPoints[2]]);
+        }
+    }
+    seam.resize(points.size(), 0);
+
+    kernel.Adopt(points, facets, true);
+}
+}  // namespace
+
 MeshSimplify::MeshSimplify(MeshKernel& mesh)
     : myKernel(mesh)
 {}
@@ -155,3 +336,111 @@ void MeshSimplify::simplify(int targetSize)
 
     myKernel.Adopt(new_points, new_facets, true);
 }
+
+void MeshSimplify::simplifyParallel(int targetSize, float maxError)
+{
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    const MeshPointArray& points = myKernel.GetPoints();
+    std::size_t numFacets = facets.size();
+    if (numFacets <= static_cast<std::size_t>(std::max(targetSize, 0))) {
+        return;
+    }
+
+    // the quadratic error is the sum of the squared distances to the planes
+    double maxQuadric = std::numeric_limits<double>::max();
+    if (maxError > 0.0F) {
+        maxQuadric = static_cast<double>(maxError) * static_cast<double>(maxError);
+    }
+
+    // the partitions only depend on the mesh so that the result doesn't depend on the
+    // number of threads
+    std::vector<Base::Vector3f> centers(numFacets);
+    std::vector<FacetIndex> indices(numFacets);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        const MeshFacet& facet = facets[i];
+        Base::Vector3f sum = points[facet._aulPoints[0]] + points[facet._aulPoints[1]]
+            + points[facet._aulPoints[2]];
+        centers[i] = sum / 3.0F;
+        indices[i] = i;
+    }
+    std::vector<std::vector<FacetIndex>> parts;
+    Partition(indices.begin(), indices.end(), centers, parts);
+
+    // points used by several partitions must not be moved
+    std::vector<char> locked(points.size(), 0);
+    std::vector<std::size_t> owner(points.size(), parts.size());
+    for (std::size_t i = 0; i < parts.size(); i++) {
+        for (FacetIndex index : parts[i]) {
+            for (PointIndex point : facets[index]._aulPoints) {
+                if (owner[point] == parts.size()) {
+                    owner[point] = i;
+                }
+                else if (owner[point] != i) {
+                    locked[point] = 1;
+                }
+            }
+        }
+    }
+
+    double reduction = static_cast<double>(targetSize) / static_cast<double>(numFacets);
+    std::vector<SimplifiedPart> results(parts.size());
+    std::atomic<std::size_t> next {0};
+    std::atomic<std::size_t> done {0};
+    auto simplifyNext = [&]() {
+        std::size_t i = next++;
+        if (i >= parts.size()) {
+            return false;
+        }
+        int target = static_cast<int>(reduction * static_cast<double>(parts[i].size()));
+        results[i] = SimplifyPart(myKernel, parts[i], locked, target, maxQuadric);
+        done++;
+        return true;
+    };
+
+    Base::SequencerLauncher seq("Decimating mesh...", parts.size() + 1);
+    int threads = std::max(int(std::thread::hardware_concurrency()), 1);
+    std::vector<std::future<void>> futures;
+    for (int i = 1; i < threads; i++) {
+        futures.push_back(std::async(std::launch::async, [&simplifyNext]() {
+            while (simplifyNext()) {}
+        }));
+    }
+    // the sequencer must only be used by this thread
+    while (simplifyNext()) {
+        seq.setProgress(done);
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    seq.setProgress(parts.size());
+
+    std::vector<char> seam;
+    Stitch(myKernel, parts, results, seam);
+    results.clear();
+
+    // now simplify the facets around the seams with all other points locked
+    std::size_t numSimplified = myKernel.CountFacets();
+    if (parts.size() > 1 && numSimplified > static_cast<std::size_t>(targetSize)) {
+        std::vector<FacetIndex> seamFacets;
+        for (std::size_t i = 0; i < numSimplified; i++) {
+            const MeshFacet& facet = myKernel.GetFacets()[i];
+            if (seam[facet._aulPoints[0]] || seam[facet._aulPoints[1]]
+                || seam[facet._aulPoints[2]]) {
+                seamFacets.push_back(i);
+            }
+        }
+        std::vector<char> unlocked(seam.size());
+        std::transform(seam.begin(), seam.end(), unlocked.begin(), [](char point) {
+            return !point;
+        });
+
+        std::size_t excess = numSimplified - static_cast<std::size_t>(targetSize);
+        std::size_t count = seamFacets.size();
+        int target = static_cast<int>(count > excess ? count - excess : 0);
+        std::vector<SimplifiedPart> seamResult;
+        seamResult.push_back(SimplifyPart(myKernel, seamFacets, unlocked, target, maxQuadric));
+        std::vector<std::vector<FacetIndex>> seamParts {std::move(seamFacets)};
+        Stitch(myKernel, seamParts, seamResult, seam);
+    }
+    seq.next();
+}
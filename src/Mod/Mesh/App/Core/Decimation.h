@@ -36,6 +36,14 @@ public:
     explicit MeshSimplify(MeshKernel&);
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
+    /**
+     * Reduces the mesh to about \a targetSize facets on several threads. The mesh is split
+     * into spatial partitions that are simplified concurrently while the vertices shared
+     * between partitions are kept. The facets around these seams are simplified afterwards.
+     * An edge is only collapsed if the new vertex has a distance of at most \a maxError to
+     * the planes of the facets it replaces. A non-positive \a maxError means no limit.
+     */
+    void simplifyParallel(int targetSize, float maxError);
 
 private:
     MeshKernel& myKernel;
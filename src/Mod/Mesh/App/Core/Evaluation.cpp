@@ -24,6 +24,9 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
 #include <vector>
 #endif
 
@@ -32,9 +35,9 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
 #include "Evaluation.h"
 #include "Functional.h"
-#include "Grid.h"
 #include "Iterator.h"
 #include "TopoAlgorithm.h"
 
@@ -132,24 +135,36 @@ bool MeshEvalOrientation::Evaluate()
 {
     const MeshFacetArray& rFAry = _rclMesh.GetFacets();
     MeshFacetArray::_TConstIterator iBeg = rFAry.begin();
-    MeshFacetArray::_TConstIterator iEnd = rFAry.end();
-    for (auto it = iBeg; it != iEnd; ++it) {
-        for (int i = 0; i < 3; i++) {
-            if (it->_aulNeighbours[i] != FACET_INDEX_MAX) {
-                const MeshFacet& rclFacet = iBeg[it->_aulNeighbours[i]];
-                for (int j = 0; j < 3; j++) {
-                    if (it->_aulPoints[i] == rclFacet._aulPoints[j]) {
-                        if ((it->_aulPoints[(i + 1) % 3] == rclFacet._aulPoints[(j + 1) % 3])
-                            || (it->_aulPoints[(i + 2) % 3] == rclFacet._aulPoints[(j + 2) % 3])) {
-                            return false;  // adjacent face with wrong orientation
+    std::atomic<bool> valid {true};
+    MeshCore::parallel_for(
+        std::size_t(0),
+        rFAry.size(),
+        [iBeg, &valid](std::size_t begin, std::size_t end) {
+            for (auto it = iBeg + begin; it != iBeg + end; ++it) {
+                if (!valid.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                for (int i = 0; i < 3; i++) {
+                    if (it->_aulNeighbours[i] != FACET_INDEX_MAX) {
+                        const MeshFacet& rclFacet = iBeg[it->_aulNeighbours[i]];
+                        for (int j = 0; j < 3; j++) {
+                            if (it->_aulPoints[i] == rclFacet._aulPoints[j]) {
+                                if ((it->_aulPoints[(i + 1) % 3]
+                                     == rclFacet._aulPoints[(j + 1) % 3])
+                                    || (it->_aulPoints[(i + 2) % 3]
+                                        == rclFacet._aulPoints[(j + 2) % 3])) {
+                                    valid = false;  // adjacent face with wrong orientation
+                                    return;
+                                }
+                            }
                         }
                     }
                 }
             }
-        }
-    }
+        },
+        int(std::thread::hardware_concurrency()));
 
-    return true;
+    return valid;
 }
 
 unsigned long MeshEvalOrientation::HasFalsePositives(const std::vector<FacetIndex>& inds) const
@@ -315,76 +330,142 @@ struct Edge_Less
 {
     bool operator()(const Edge_Index& x, const Edge_Index& y) const
     {
-        if (x.p0 < y.p0) {
-            return true;
-        }
-        if (x.p0 > y.p0) {
-            return false;
+        if (x.p0 != y.p0) {
+            return x.p0 < y.p0;
         }
-        if (x.p1 < y.p1) {
-            return true;
-        }
-        if (x.p1 > y.p1) {
-            return false;
+        if (x.p1 != y.p1) {
+            return x.p1 < y.p1;
         }
-        return false;
+        // the facet index makes the order of equal edges independent of the sort algorithm
+        return x.f < y.f;
     }
 };
 
-}  // namespace MeshCore
+using EdgeIterator = std::vector<Edge_Index>::const_iterator;
 
-bool MeshEvalTopology::Evaluate()
+static int EdgeThreads()
 {
-    // Using and sorting a vector seems to be faster and more memory-efficient
-    // than a map.
-    const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
-
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking topology...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
-        }
+    return std::max(1, int(std::thread::hardware_concurrency()));
+}
 
-        seq.next();
-    }
+static bool SameEdge(const Edge_Index& x, const Edge_Index& y)
+{
+    return x.p0 == y.p0 && x.p1 == y.p1;
+}
 
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
+/**
+ * Returns the edges of all facets from index \a first on sorted by their point indices.
+ * Using and sorting a vector seems to be faster and more memory-efficient than a map.
+ */
+static std::vector<Edge_Index>
+SortedEdges(const MeshFacetArray& rFacets, FacetIndex first, int threads)
+{
+    std::vector<Edge_Index> edges(3 * (rFacets.size() - first));
+    MeshCore::parallel_for(
+        std::size_t(first),
+        rFacets.size(),
+        [&rFacets, &edges, first](std::size_t begin, std::size_t end) {
+            auto item = edges.begin() + 3 * (begin - first);
+            for (std::size_t index = begin; index < end; ++index) {
+                const MeshFacet& rFace = rFacets[index];
+                for (int i = 0; i < 3; i++, ++item) {
+                    PointIndex p0 = rFace._aulPoints[i];
+                    PointIndex p1 = rFace._aulPoints[(i + 1) % 3];
+                    item->p0 = std::min<PointIndex>(p0, p1);
+                    item->p1 = std::max<PointIndex>(p0, p1);
+                    item->f = index;
+                }
+            }
+        },
+        threads);
 
-    // search for non-manifold edges
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    nonManifoldList.clear();
-    nonManifoldFacets.clear();
+    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
+    return edges;
+}
 
-    int count = 0;
-    std::vector<FacetIndex> facets;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            count++;
-            facets.push_back(pE->f);
+/**
+ * Splits the sorted edges into up to \a threads blocks without separating equal edges and
+ * calls \a func(block, first, last) for every range [first, last) of equal edges. The blocks
+ * are processed in parallel, the ranges of one block in ascending order. Unless \a seq is
+ * null it advances by one step for every finished block.
+ */
+template<class Func>
+static void ForEachEdgeGroup(const std::vector<Edge_Index>& edges,
+                             int threads,
+                             Base::SequencerLauncher* seq,
+                             Func func)
+{
+    std::size_t count = edges.size();
+    std::size_t blocks =
+        std::min<std::size_t>(std::max(threads, 1), std::max<std::size_t>(count, 1));
+
+    std::vector<EdgeIterator> bounds;
+    bounds.reserve(blocks + 1);
+    bounds.push_back(edges.begin());
+    for (std::size_t i = 1; i < blocks; i++) {
+        auto it = std::max(edges.begin() + count * i / blocks, bounds.back());
+        while (it != edges.begin() && it != edges.end() && SameEdge(*(it - 1), *it)) {
+            ++it;
         }
-        else {
-            if (count > 2) {
-                // Edge that is shared by more than 2 facets
-                nonManifoldList.emplace_back(p0, p1);
-                nonManifoldFacets.push_back(facets);
+        bounds.push_back(it);
+    }
+    bounds.push_back(edges.end());
+
+    MeshCore::parallel_for(
+        std::size_t(0),
+        blocks,
+        [&bounds, &func](std::size_t begin, std::size_t end) {
+            for (std::size_t block = begin; block < end; block++) {
+                EdgeIterator last = bounds[block + 1];
+                for (EdgeIterator it = bounds[block]; it != last;) {
+                    EdgeIterator next = it + 1;
+                    while (next != last && SameEdge(*it, *next)) {
+                        ++next;
+                    }
+                    func(block, it, next);
+                    it = next;
+                }
             }
+        },
+        threads,
+        [seq]() {
+            if (seq) {
+                seq->next();
+            }
+        });
+}
 
-            p0 = pE->p0;
-            p1 = pE->p1;
-            facets.clear();
-            facets.push_back(pE->f);
-            count = 1;
+}  // namespace MeshCore
+
+bool MeshEvalTopology::Evaluate()
+{
+    const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
+    int threads = EdgeThreads();
+    Base::SequencerLauncher seq("Checking topology...", threads + 1);
+    std::vector<Edge_Index> edges = SortedEdges(rclFAry, 0, threads);
+    seq.next();
+
+    // search for non-manifold edges, i.e. edges that are shared by more than 2 facets
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex>>> edgeBlocks(threads);
+    std::vector<std::list<std::vector<FacetIndex>>> facetBlocks(threads);
+    auto collectNonManifolds = [&](std::size_t block, EdgeIterator first, EdgeIterator last) {
+        if (last - first > 2) {
+            std::vector<FacetIndex> facets;
+            facets.reserve(last - first);
+            for (auto it = first; it != last; ++it) {
+                facets.push_back(it->f);
+            }
+            edgeBlocks[block].emplace_back(first->p0, first->p1);
+            facetBlocks[block].push_back(std::move(facets));
         }
+    };
+    ForEachEdgeGroup(edges, threads, &seq, collectNonManifolds);
+
+    nonManifoldList.clear();
+    nonManifoldFacets.clear();
+    for (int i = 0; i < threads; i++) {
+        nonManifoldList.insert(nonManifoldList.end(), edgeBlocks[i].begin(), edgeBlocks[i].end());
+        nonManifoldFacets.splice(nonManifoldFacets.end(), facetBlocks[i]);
     }
 
     return nonManifoldList.empty();
@@ -597,81 +678,53 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+std::vector<std::pair<FacetIndex, FacetIndex>> FindSelfIntersections(const MeshFacetBVH& bvh,
+                                                                     bool stopAtFirst)
+{
+    const MeshKernel& rMesh = bvh.GetMesh();
+    const MeshFacetArray& rFaces = rMesh.GetFacets();
+    std::function<bool(FacetIndex, FacetIndex, std::pair<FacetIndex, FacetIndex>&)> test =
+        [&rMesh, &rFaces](FacetIndex index1,
+                          FacetIndex index2,
+                          std::pair<FacetIndex, FacetIndex>& result) {
+            // If the facets share a common vertex we do not check for self-intersections
+            // because they could but usually do not intersect each other and the algorithm
+            // below would detect false-positives, otherwise
+            const MeshFacet& rface1 = rFaces[index1];
+            const MeshFacet& rface2 = rFaces[index2];
+            for (PointIndex point : rface1._aulPoints) {
+                if (rface2.HasPoint(point)) {
+                    return false;
                 }
+            }
 
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
+            Base::Vector3f pt1, pt2;
+            MeshGeomFacet facet1 = rMesh.GetFacet(rface1);
+            MeshGeomFacet facet2 = rMesh.GetFacet(rface2);
+            if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                result = std::make_pair(index1, index2);
+                return true;
             }
-        }
-    }
+            return false;
+        };
 
-    return true;
+    return bvh.CollectPairs(bvh,
+                            test,
+                            stopAtFirst,
+                            int(std::thread::hardware_concurrency()),
+                            "Checking for self-intersections...");
+}
+}  // namespace
+
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    if (_bvh) {
+        return FindSelfIntersections(*_bvh, true).empty();
+    }
+    MeshFacetBVH bvh(_rclMesh);
+    return FindSelfIntersections(bvh, true).empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -702,77 +755,16 @@ void MeshEvalSelfIntersection::GetIntersections(
 void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
+    if (_bvh) {
+        pairs = FindSelfIntersections(*_bvh, false);
     }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
-            }
-        }
+    else {
+        MeshFacetBVH bvh(_rclMesh);
+        pairs = FindSelfIntersections(bvh, false);
     }
+    std::sort(pairs.begin(), pairs.end());
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -812,6 +804,33 @@ bool MeshFixSelfIntersection::Fixup()
 
 // ----------------------------------------------------------------
 
+namespace
+{
+/// Checks whether the facets of the range of equal edges reference each other as neighbours
+bool HasValidNeighbours(const MeshFacetArray& rFacets, EdgeIterator first, EdgeIterator last)
+{
+    // we handle only the cases for 1 and 2, for all higher
+    // values we have a non-manifold that is ignored here
+    if (last - first == 2) {
+        const Edge_Index& edge0 = first[0];
+        const Edge_Index& edge1 = first[1];
+        const MeshFacet& rFace0 = rFacets[edge0.f];
+        const MeshFacet& rFace1 = rFacets[edge1.f];
+        unsigned short side0 = rFace0.Side(edge0.p0, edge0.p1);
+        unsigned short side1 = rFace1.Side(edge0.p0, edge0.p1);
+        return rFace0._aulNeighbours[side0] == edge1.f && rFace1._aulNeighbours[side1] == edge0.f;
+    }
+    if (last - first == 1) {
+        const MeshFacet& rFace = rFacets[first->f];
+        unsigned short side = rFace.Side(first->p0, first->p1);
+        // should be "open edge" but isn't marked as such
+        return rFace._aulNeighbours[side] == FACET_INDEX_MAX;
+    }
+
+    return true;
+}
+}  // namespace
+
 bool MeshEvalNeighbourhood::Evaluate()
 {
     // Note: If more than two facets are attached to the edge then we have a
@@ -821,136 +840,44 @@ bool MeshEvalNeighbourhood::Evaluate()
     // edges and thus we ignore this case.
     // Non-manifolds are an own category of errors and are handled by the class
     // MeshEvalTopology.
-    //
-    // Using and sorting a vector seems to be faster and more memory-efficient
-    // than a map.
     const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
-
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking indices...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
+    int threads = EdgeThreads();
+    Base::SequencerLauncher seq("Checking indices...", threads + 1);
+    std::vector<Edge_Index> edges = SortedEdges(rclFAry, 0, threads);
+    seq.next();
+
+    std::atomic<bool> valid {true};
+    auto checkNeighbours = [&](std::size_t, EdgeIterator first, EdgeIterator last) {
+        if (valid.load(std::memory_order_relaxed) && !HasValidNeighbours(rclFAry, first, last)) {
+            valid = false;
         }
+    };
+    ForEachEdgeGroup(edges, threads, &seq, checkNeighbours);
 
-        seq.next();
-    }
-
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
-
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
-        }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                const MeshFacet& rFace0 = rclFAry[f0];
-                const MeshFacet& rFace1 = rclFAry[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                // Check whether rFace0 and rFace1 reference each other as
-                // neighbours
-                if (rFace0._aulNeighbours[side0] != f1 || rFace1._aulNeighbours[side1] != f0) {
-                    return false;
-                }
-            }
-            else if (count == 1) {
-                const MeshFacet& rFace = rclFAry[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                // should be "open edge" but isn't marked as such
-                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX) {
-                    return false;
-                }
-            }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
-        }
-    }
-
-    return true;
+    return valid;
 }
 
 std::vector<FacetIndex> MeshEvalNeighbourhood::GetIndices() const
 {
-    std::vector<FacetIndex> inds;
     const MeshFacetArray& rclFAry = _rclMesh.GetFacets();
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * rclFAry.size());
-
-    // build up an array of edges
-    MeshFacetArray::_TConstIterator pI;
-    Base::SequencerLauncher seq("Checking indices...", rclFAry.size());
-    for (pI = rclFAry.begin(); pI != rclFAry.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - rclFAry.begin();
-            edges.push_back(item);
-        }
-
-        seq.next();
-    }
-
-    // sort the edges
-    std::sort(edges.begin(), edges.end(), Edge_Less());
-
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
-        }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                const MeshFacet& rFace0 = rclFAry[f0];
-                const MeshFacet& rFace1 = rclFAry[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                // Check whether rFace0 and rFace1 reference each other as
-                // neighbours
-                if (rFace0._aulNeighbours[side0] != f1 || rFace1._aulNeighbours[side1] != f0) {
-                    inds.push_back(f0);
-                    inds.push_back(f1);
-                }
-            }
-            else if (count == 1) {
-                const MeshFacet& rFace = rclFAry[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                // should be "open edge" but isn't marked as such
-                if (rFace._aulNeighbours[side] != FACET_INDEX_MAX) {
-                    inds.push_back(f0);
-                }
+    int threads = EdgeThreads();
+    Base::SequencerLauncher seq("Checking indices...", threads + 1);
+    std::vector<Edge_Index> edges = SortedEdges(rclFAry, 0, threads);
+    seq.next();
+
+    std::vector<std::vector<FacetIndex>> blocks(threads);
+    auto collectInvalid = [&](std::size_t block, EdgeIterator first, EdgeIterator last) {
+        if (!HasValidNeighbours(rclFAry, first, last)) {
+            for (auto it = first; it != last; ++it) {
+                blocks[block].push_back(it->f);
             }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
         }
+    };
+    ForEachEdgeGroup(edges, threads, &seq, collectInvalid);
+
+    std::vector<FacetIndex> inds;
+    for (const auto& it : blocks) {
+        inds.insert(inds.end(), it.begin(), it.end());
     }
 
     // remove duplicates
@@ -968,74 +895,31 @@ bool MeshFixNeighbourhood::Fixup()
 
 void MeshKernel::RebuildNeighbours(FacetIndex index)
 {
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * (this->_aclFacetArray.size() - index));
-
-    // build up an array of edges
-    auto pB = this->_aclFacetArray.begin();
-    for (auto pI = pB + index; pI != this->_aclFacetArray.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - pB;
-            edges.push_back(item);
+    int threads = EdgeThreads();
+    std::vector<Edge_Index> edges = SortedEdges(this->_aclFacetArray, index, threads);
+
+    // Every edge belongs to exactly one range, so the ranges can be linked in parallel
+    // without two threads writing to the same neighbour index.
+    auto linkNeighbours = [this](std::size_t, EdgeIterator first, EdgeIterator last) {
+        // we handle only the cases for 1 and 2, for all higher
+        // values we have a non-manifold that is ignored here
+        if (last - first == 2) {
+            const Edge_Index& edge0 = first[0];
+            const Edge_Index& edge1 = first[1];
+            MeshFacet& rFace0 = this->_aclFacetArray[edge0.f];
+            MeshFacet& rFace1 = this->_aclFacetArray[edge1.f];
+            unsigned short side0 = rFace0.Side(edge0.p0, edge0.p1);
+            unsigned short side1 = rFace1.Side(edge0.p0, edge0.p1);
+            rFace0._aulNeighbours[side0] = edge1.f;
+            rFace1._aulNeighbours[side1] = edge0.f;
         }
-    }
-
-    // sort the edges
-    // std::sort(edges.begin(), edges.end(), Edge_Less());
-    int threads = int(std::thread::hardware_concurrency());
-    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
-
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
+        else if (last - first == 1) {
+            MeshFacet& rFace = this->_aclFacetArray[first->f];
+            unsigned short side = rFace.Side(first->p0, first->p1);
+            rFace._aulNeighbours[side] = FACET_INDEX_MAX;
         }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                MeshFacet& rFace0 = this->_aclFacetArray[f0];
-                MeshFacet& rFace1 = this->_aclFacetArray[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                rFace0._aulNeighbours[side0] = f1;
-                rFace1._aulNeighbours[side1] = f0;
-            }
-            else if (count == 1) {
-                MeshFacet& rFace = this->_aclFacetArray[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                rFace._aulNeighbours[side] = FACET_INDEX_MAX;
-            }
-
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
-        }
-    }
-
-    // we handle only the cases for 1 and 2, for all higher
-    // values we have a non-manifold that is ignored here
-    if (count == 2) {
-        MeshFacet& rFace0 = this->_aclFacetArray[f0];
-        MeshFacet& rFace1 = this->_aclFacetArray[f1];
-        unsigned short side0 = rFace0.Side(p0, p1);
-        unsigned short side1 = rFace1.Side(p0, p1);
-        rFace0._aulNeighbours[side0] = f1;
-        rFace1._aulNeighbours[side1] = f0;
-    }
-    else if (count == 1) {
-        MeshFacet& rFace = this->_aclFacetArray[f0];
-        unsigned short side = rFace.Side(p0, p1);
-        rFace._aulNeighbours[side] = FACET_INDEX_MAX;
-    }
+    };
+    ForEachEdgeGroup(edges, threads, nullptr, linkNeighbours);
 }
 
 void MeshKernel::RebuildNeighbours()
@@ -26,6 +26,7 @@
 #include <cmath>
 #include <list>
 
+#include "BVH.h"
 #include "MeshKernel.h"
 #include "Visitor.h"
 
@@ -330,6 +331,11 @@ public:
     explicit MeshEvalSelfIntersection(const MeshKernel& rclB)
         : MeshEvaluation(rclB)
     {}
+    /// Uses the given hierarchy of the mesh instead of building a new one
+    explicit MeshEvalSelfIntersection(const MeshFacetBVH& bvh)
+        : MeshEvaluation(bvh.GetMesh())
+        , _bvh(&bvh)
+    {}
     /// Evaluate the mesh and return if true if there are self intersections
     bool Evaluate() override;
     /// collect all intersection lines
@@ -337,6 +343,9 @@ public:
                           std::vector<std::pair<Base::Vector3f, Base::Vector3f>>&) const;
     /// collect the index of all facets with self intersections
     void GetIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&) const;
+
+private:
+    const MeshFacetBVH* _bvh {nullptr};
 };
 
 /**
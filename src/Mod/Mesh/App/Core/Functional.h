@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +63,47 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/** Splits the index range [begin, end) into up to \a threads consecutive blocks of about
+ * the same size and calls \a func(first, last) for each block on its own thread.
+ * \a done() is called on the calling thread once for every finished block, e.g. to
+ * advance a progress indicator.
+ */
+template<class Size, class Func, class Done>
+static void parallel_for(Size begin, Size end, Func func, int threads, Done done)
+{
+    Size count = end - begin;
+    Size blocks = std::min(static_cast<Size>(std::max(threads, 1)), count);
+    if (blocks < 2) {
+        func(begin, end);
+        done();
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(blocks - 1);
+    for (Size i = 1; i < blocks; i++) {
+        futures.push_back(std::async(std::launch::async,
+                                     func,
+                                     begin + count * i / blocks,
+                                     begin + count * (i + 1) / blocks));
+    }
+    func(begin, begin + count / blocks);
+    done();
+    for (auto& future : futures) {
+        future.get();
+        done();
+    }
+}
+
+/** Splits the index range [begin, end) into up to \a threads consecutive blocks of about
+ * the same size and calls \a func(first, last) for each block on its own thread.
+ */
+template<class Size, class Func>
+static void parallel_for(Size begin, Size end, Func func, int threads)
+{
+    parallel_for(begin, end, func, threads, [] {});
+}
+
 }  // namespace MeshCore
 
 
@@ -25,9 +25,12 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string_view>
+#include <thread>
+#include <vector>
 #endif
 
 #include <boost/algorithm/string.hpp>
@@ -58,6 +61,7 @@
 #include "Builder.h"
 #include "Definitions.h"
 #include "Degeneration.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -801,8 +805,6 @@ bool MeshInput::LoadAsciiSTL(std::istream& input)
 bool MeshInput::LoadBinarySTL(std::istream& input)
 {
     char szInfo[80];
-    Base::Vector3f clVects[4];
-    uint16_t usAtt = 0;
     uint32_t ulCt = 0;
 
     if (!input || input.bad()) {
@@ -835,22 +837,42 @@ bool MeshInput::LoadBinarySTL(std::istream& input)
         return false;  // not a valid STL file
     }
 
-#if 0
-    MeshBuilder builder(this->_rclMesh);
-#else
     MeshFastBuilder builder(this->_rclMesh);
-#endif
     builder.Initialize(ulCt);
 
-    for (uint32_t i = 0; i < ulCt; i++) {
-        // read normal, points
-        input.read((char*)&clVects, sizeof(clVects));
-
-        std::swap(clVects[0], clVects[3]);
-        builder.AddFacet(clVects);
+    // Read the records in blocks instead of one by one and decode each block in parallel
+    // into a preallocated point array.
+    constexpr std::size_t recordSize = 50;
+    const uint32_t blockSize = 262144;
+    const int threads = int(std::thread::hardware_concurrency());
+    std::vector<char> records;
+    std::vector<Base::Vector3f> points;
+    for (uint32_t i = 0; i < ulCt; i += blockSize) {
+        uint32_t count = std::min(blockSize, ulCt - i);
+        records.resize(count * recordSize);
+        points.resize(3 * std::size_t(count));
+        if (!input.read(records.data(), static_cast<std::streamsize>(records.size()))) {
+            return false;
+        }
+
+        const char* src = records.data();
+        Base::Vector3f* dst = points.data();
+        MeshCore::parallel_for(
+            std::size_t(0),
+            std::size_t(count),
+            [src, dst](std::size_t first, std::size_t last) {
+                Base::Vector3f clVects[4];
+                for (std::size_t j = first; j < last; j++) {
+                    // read normal, points and overread 2 bytes attribute
+                    std::memcpy(clVects, src + j * recordSize, sizeof(clVects));
+                    dst[3 * j] = clVects[3];
+                    dst[3 * j + 1] = clVects[1];
+                    dst[3 * j + 2] = clVects[2];
+                }
+            },
+            threads);
 
-        // overread 2 bytes attribute
-        input.read((char*)&usAtt, sizeof(usAtt));
+        builder.AddFacets(points.data(), MeshFastBuilder::size_type(count));
     }
 
     builder.Finish();
@@ -29,6 +29,7 @@
 #include <map>
 #include <queue>
 #include <stdexcept>
+#include <vector>
 #endif
 
 #include <Base/Exception.h>
@@ -46,6 +47,35 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// Points and facets are streamed in blocks of this size instead of value by value
+constexpr std::size_t StreamBlockSize = 65536;
+
+template<typename T>
+void writeBlock(std::ostream& out, const std::vector<T>& block)
+{
+    out.write(reinterpret_cast<const char*>(block.data()),  // NOLINT
+              static_cast<std::streamsize>(block.size() * sizeof(T)));
+}
+
+template<typename T>
+void readBlock(std::istream& in, std::vector<T>& block, std::size_t count, bool swap)
+{
+    block.resize(count);
+    in.read(reinterpret_cast<char*>(block.data()),  // NOLINT
+            static_cast<std::streamsize>(count * sizeof(T)));
+    if (!in) {
+        throw Base::BadFormatError("Unexpected end of stream");
+    }
+    if (swap) {
+        for (auto& it : block) {
+            Base::SwapEndian(it);
+        }
+    }
+}
+}  // namespace
+
 MeshKernel::MeshKernel()
 {
     _clBoundBox.SetVoid();
@@ -898,17 +928,33 @@ void MeshKernel::Write(std::ostream& rclOut) const
     // write the number of points and facets
     str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
 
-    // write the data
-    for (const auto& it : _aclPointArray) {
-        str << it.x << it.y << it.z;
-    }
-
-    for (const auto& it : _aclFacetArray) {
-        str << static_cast<uint32_t>(it._aulPoints[0]) << static_cast<uint32_t>(it._aulPoints[1])
-            << static_cast<uint32_t>(it._aulPoints[2]);
-        str << static_cast<uint32_t>(it._aulNeighbours[0])
-            << static_cast<uint32_t>(it._aulNeighbours[1])
-            << static_cast<uint32_t>(it._aulNeighbours[2]);
+    // write the data, the layout is the same as writing the values one by one
+    std::vector<float> coords;
+    for (std::size_t i = 0; i < _aclPointArray.size(); i += StreamBlockSize) {
+        std::size_t end = std::min(i + StreamBlockSize, _aclPointArray.size());
+        coords.clear();
+        for (std::size_t j = i; j < end; j++) {
+            const MeshPoint& pnt = _aclPointArray[j];
+            coords.insert(coords.end(), {pnt.x, pnt.y, pnt.z});
+        }
+        writeBlock(rclOut, coords);
+    }
+
+    std::vector<uint32_t> indices;
+    for (std::size_t i = 0; i < _aclFacetArray.size(); i += StreamBlockSize) {
+        std::size_t end = std::min(i + StreamBlockSize, _aclFacetArray.size());
+        indices.clear();
+        for (std::size_t j = i; j < end; j++) {
+            const MeshFacet& face = _aclFacetArray[j];
+            indices.insert(indices.end(),
+                           {static_cast<uint32_t>(face._aulPoints[0]),
+                            static_cast<uint32_t>(face._aulPoints[1]),
+                            static_cast<uint32_t>(face._aulPoints[2]),
+                            static_cast<uint32_t>(face._aulNeighbours[0]),
+                            static_cast<uint32_t>(face._aulNeighbours[1]),
+                            static_cast<uint32_t>(face._aulNeighbours[2])});
+        }
+        writeBlock(rclOut, indices);
     }
 
     str << _clBoundBox.MinX << _clBoundBox.MaxX;
@@ -954,64 +1000,55 @@ void MeshKernel::Read(std::istream& rclIn)
 
         try {
             // read the data
+            bool swap = (str.byteOrder() == Base::Stream::BigEndian);
             MeshPointArray pointArray;
             pointArray.resize(uCtPts);
-            for (auto& it : pointArray) {
-                str >> it.x >> it.y >> it.z;
+            std::vector<float> coords;
+            for (std::size_t i = 0; i < uCtPts; i += StreamBlockSize) {
+                std::size_t count = std::min<std::size_t>(StreamBlockSize, uCtPts - i);
+                readBlock(rclIn, coords, 3 * count, swap);
+                for (std::size_t j = 0; j < count; j++) {
+                    MeshPoint& pnt = pointArray[i + j];
+                    pnt.x = coords[3 * j];
+                    pnt.y = coords[3 * j + 1];
+                    pnt.z = coords[3 * j + 2];
+                }
             }
 
             MeshFacetArray facetArray;
             facetArray.resize(uCtFts);
 
-            uint32_t v1 {}, v2 {}, v3 {};
-            for (auto& it : facetArray) {
-                str >> v1 >> v2 >> v3;
-
+            // On systems where an 'unsigned long' is a 64-bit value
+            // the empty neighbour must be explicitly set to 'FACET_INDEX_MAX'
+            // because in algorithms this value is always used to check
+            // for open edges.
+            auto toNeighbour = [uCtFts, open_edge](uint32_t index) {
                 // make sure to have valid indices
-                if (v1 >= uCtPts || v2 >= uCtPts || v3 >= uCtPts) {
+                if (index >= uCtFts && index < open_edge) {
                     throw Base::BadFormatError("Invalid data structure");
                 }
+                return index < open_edge ? FacetIndex(index) : FACET_INDEX_MAX;
+            };
+
+            std::vector<uint32_t> indices;
+            for (std::size_t i = 0; i < uCtFts; i += StreamBlockSize) {
+                std::size_t count = std::min<std::size_t>(StreamBlockSize, uCtFts - i);
+                readBlock(rclIn, indices, 6 * count, swap);
+                for (std::size_t j = 0; j < count; j++) {
+                    const uint32_t* v = &indices[6 * j];
+
+                    // make sure to have valid indices
+                    if (v[0] >= uCtPts || v[1] >= uCtPts || v[2] >= uCtPts) {
+                        throw Base::BadFormatError("Invalid data structure");
+                    }
 
-                it._aulPoints[0] = v1;
-                it._aulPoints[1] = v2;
-                it._aulPoints[2] = v3;
-
-                // On systems where an 'unsigned long' is a 64-bit value
-                // the empty neighbour must be explicitly set to 'FACET_INDEX_MAX'
-                // because in algorithms this value is always used to check
-                // for open edges.
-                str >> v1 >> v2 >> v3;
-
-                // make sure to have valid indices
-                if (v1 >= uCtFts && v1 < open_edge) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-                if (v2 >= uCtFts && v2 < open_edge) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-                if (v3 >= uCtFts && v3 < open_edge) {
-                    throw Base::BadFormatError("Invalid data structure");
-                }
-
-                if (v1 < open_edge) {
-                    it._aulNeighbours[0] = v1;
-                }
-                else {
-                    it._aulNeighbours[0] = FACET_INDEX_MAX;
-                }
-
-                if (v2 < open_edge) {
-                    it._aulNeighbours[1] = v2;
-                }
-                else {
-                    it._aulNeighbours[1] = FACET_INDEX_MAX;
-                }
-
-                if (v3 < open_edge) {
-                    it._aulNeighbours[2] = v3;
-                }
-                else {
-                    it._aulNeighbours[2] = FACET_INDEX_MAX;
+                    MeshFacet& face = facetArray[i + j];
+                    face._aulPoints[0] = v[0];
+                    face._aulPoints[1] = v[1];
+                    face._aulPoints[2] = v[2];
+                    face._aulNeighbours[0] = toNeighbour(v[3]);
+                    face._aulNeighbours[1] = toNeighbour(v[4]);
+                    face._aulNeighbours[2] = toNeighbour(v[5]);
                 }
             }
 
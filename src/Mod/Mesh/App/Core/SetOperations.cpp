@@ -24,13 +24,16 @@
 
 #ifndef _PreComp_
 #include <fstream>
+#include <functional>
 #include <ios>
+#include <thread>
 #endif
 
 #include <Base/Builder3D.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
+#include "BVH.h"
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
@@ -625,109 +628,46 @@ bool MeshIntersection::hasIntersection() const
     return (testIntersection(kernel1, kernel2));
 }
 
-void MeshIntersection::getIntersection(std::list<MeshIntersection::Tuple>& intsct) const
+namespace
 {
-    const MeshKernel& k1 = kernel1;
-    const MeshKernel& k2 = kernel2;
-
-    // Contains bounding boxes for every facet of 'k1'
-    std::vector<Base::BoundBox3f> boxes1;
-    MeshFacetIterator cMFI1(k1);
-    for (cMFI1.Begin(); cMFI1.More(); cMFI1.Next()) {
-        boxes1.push_back((*cMFI1).GetBoundBox());
-    }
+std::vector<MeshIntersection::Tuple>
+FindIntersections(const MeshKernel& k1, const MeshKernel& k2, bool stopAtFirst)
+{
+    MeshFacetBVH bvh1(k1);
+    MeshFacetBVH bvh2(k2);
+    std::function<bool(FacetIndex, FacetIndex, MeshIntersection::Tuple&)> test =
+        [&k1, &k2](FacetIndex index1, FacetIndex index2, MeshIntersection::Tuple& result) {
+            MeshGeomFacet facet1 = k1.GetFacet(index1);
+            MeshGeomFacet facet2 = k2.GetFacet(index2);
+            Base::Vector3f pt1, pt2;
+            if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                result.p1 = pt1;
+                result.p2 = pt2;
+                result.f1 = index1;
+                result.f2 = index2;
+                return true;
+            }
+            return false;
+        };
 
-    // Contains bounding boxes for every facet of 'k2'
-    std::vector<Base::BoundBox3f> boxes2;
-    MeshFacetIterator cMFI2(k2);
-    for (cMFI2.Begin(); cMFI2.More(); cMFI2.Next()) {
-        boxes2.push_back((*cMFI2).GetBoundBox());
-    }
+    return bvh1.CollectPairs(bvh2,
+                             test,
+                             stopAtFirst,
+                             int(std::thread::hardware_concurrency()),
+                             "Checking for intersections...");
+}
+}  // namespace
 
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(k1);
-
-    const MeshFacetArray& rFaces2 = k2.GetFacets();
-    Base::SequencerLauncher seq("Checking for intersections...", rFaces2.size());
-    int index = 0;
-    MeshGeomFacet facet1, facet2;
-    Base::Vector3f pt1, pt2;
-
-    // Iterate over the facets of the 2nd mesh and find the grid elements of the 1st mesh
-    for (auto it = rFaces2.begin(); it != rFaces2.end(); ++it, index++) {
-        seq.next();
-        std::vector<FacetIndex> elements;
-        cMeshFacetGrid.Inside(boxes2[index], elements, true);
-
-        cMFI2.Set(index);
-        facet2 = *cMFI2;
-
-        for (FacetIndex element : elements) {
-            if (boxes2[index] && boxes1[element]) {
-                cMFI1.Set(element);
-                facet1 = *cMFI1;
-                int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                if (ret == 2) {
-                    Tuple d;
-                    d.p1 = pt1;
-                    d.p2 = pt2;
-                    d.f1 = element;
-                    d.f2 = index;
-                    intsct.push_back(d);
-                }
-            }
-        }
-    }
+void MeshIntersection::getIntersection(std::list<MeshIntersection::Tuple>& intsct) const
+{
+    std::vector<Tuple> found = FindIntersections(kernel1, kernel2, false);
+    intsct.insert(intsct.end(), found.begin(), found.end());
 }
 
 bool MeshIntersection::testIntersection(const MeshKernel& k1, const MeshKernel& k2)
 {
-    // Contains bounding boxes for every facet of 'k1'
-    std::vector<Base::BoundBox3f> boxes1;
-    MeshFacetIterator cMFI1(k1);
-    for (cMFI1.Begin(); cMFI1.More(); cMFI1.Next()) {
-        boxes1.push_back((*cMFI1).GetBoundBox());
-    }
-
-    // Contains bounding boxes for every facet of 'k2'
-    std::vector<Base::BoundBox3f> boxes2;
-    MeshFacetIterator cMFI2(k2);
-    for (cMFI2.Begin(); cMFI2.More(); cMFI2.Next()) {
-        boxes2.push_back((*cMFI2).GetBoundBox());
-    }
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(k1);
-
-    const MeshFacetArray& rFaces2 = k2.GetFacets();
-    Base::SequencerLauncher seq("Checking for intersections...", rFaces2.size());
-    int index = 0;
-    MeshGeomFacet facet1, facet2;
-    Base::Vector3f pt1, pt2;
-
-    // Iterate over the facets of the 2nd mesh and find the grid elements of the 1st mesh
-    for (auto it = rFaces2.begin(); it != rFaces2.end(); ++it, index++) {
-        seq.next();
-        std::vector<FacetIndex> elements;
-        cMeshFacetGrid.Inside(boxes2[index], elements, true);
-
-        cMFI2.Set(index);
-        facet2 = *cMFI2;
-
-        for (FacetIndex element : elements) {
-            if (boxes2[index] && boxes1[element]) {
-                cMFI1.Set(element);
-                facet1 = *cMFI1;
-                int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                if (ret == 2) {
-                    // abort after the first detected self-intersection
-                    return true;
-                }
-            }
-        }
-    }
-
-    return false;
+    // abort after the first detected intersection
+    return !FindIntersections(k1, k2, true).empty();
 }
 
 void MeshIntersection::connectLines(bool onlyclosed,
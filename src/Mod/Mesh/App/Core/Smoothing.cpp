@@ -23,12 +23,14 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <cmath>
+#include <thread>
 #endif
 
 #include <Base/Tools.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
@@ -37,6 +39,105 @@
 using namespace MeshCore;
 
 
+namespace
+{
+int SmoothingThreads()
+{
+    return int(std::thread::hardware_concurrency());
+}
+
+std::vector<Base::Vector3f> CopyPoints(const MeshKernel& kernel)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    std::vector<Base::Vector3f> result(points.begin(), points.end());
+    return result;
+}
+
+void AssignPoints(MeshKernel& kernel, const std::vector<Base::Vector3f>& points)
+{
+    MeshCore::parallel_for(
+        std::size_t(0),
+        points.size(),
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t pos = first; pos < last; pos++) {
+                kernel.SetPoint(pos, points[pos]);
+            }
+        },
+        SmoothingThreads());
+}
+
+// Moves the point towards the mean plane of its neighbours
+Base::Vector3f PlaneFitPoint(const MeshPointAdjacency& adjacency,
+                             const std::vector<Base::Vector3f>& points,
+                             PointIndex pos,
+                             float maximum)
+{
+    const Base::Vector3f& point = points[pos];
+    MeshPointAdjacency::Row<PointIndex> cv = adjacency.GetPoints(pos);
+    if (cv.size() < 3) {
+        return point;
+    }
+
+    MeshCore::PlaneFit pf;
+    pf.AddPoint(point);
+    Base::Vector3f center = point;
+    for (PointIndex index : cv) {
+        pf.AddPoint(points[index]);
+        center += points[index];
+    }
+
+    float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
+    center.Scale(scale, scale, scale);
+
+    // get the mean plane of the current vertex with the surrounding vertices
+    pf.Fit();
+    Base::Vector3f N = pf.GetNormal();
+    N.Normalize();
+
+    // look in which direction we should move the vertex
+    Base::Vector3f L = point - center;
+    if (N * L < 0.0F) {
+        N.Scale(-1.0, -1.0, -1.0);
+    }
+
+    // maximum value to move is distance to mean plane
+    float d = std::min<float>(std::fabs(maximum), std::fabs(N * L));
+    N.Scale(d, d, d);
+
+    return point - N;
+}
+
+// Moves the point towards the center of its neighbours
+Base::Vector3f UmbrellaPoint(const MeshPointAdjacency& adjacency,
+                             const std::vector<Base::Vector3f>& points,
+                             PointIndex pos,
+                             double stepsize)
+{
+    const Base::Vector3f& point = points[pos];
+    MeshPointAdjacency::Row<PointIndex> cv = adjacency.GetPoints(pos);
+    if (cv.size() < 3) {
+        return point;
+    }
+    if (cv.size() != adjacency.GetFacets(pos).size()) {
+        // do nothing for border points
+        return point;
+    }
+
+    double w = 1.0 / double(cv.size());
+    double delx = 0.0, dely = 0.0, delz = 0.0;
+    for (PointIndex index : cv) {
+        delx += w * static_cast<double>(points[index].x - point.x);
+        dely += w * static_cast<double>(points[index].y - point.y);
+        delz += w * static_cast<double>(points[index].z - point.z);
+    }
+
+    float x = static_cast<float>(static_cast<double>(point.x) + stepsize * delx);
+    float y = static_cast<float>(static_cast<double>(point.y) + stepsize * dely);
+    float z = static_cast<float>(static_cast<double>(point.z) + stepsize * delz);
+    return Base::Vector3f(x, y, z);
+}
+}  // namespace
+
 AbstractSmoothing::AbstractSmoothing(MeshKernel& m)
     : kernel(m)
 {}
@@ -55,213 +156,115 @@ PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
 
 void PlaneFitSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    std::vector<Base::Vector3f> points = CopyPoints(kernel);
+    std::vector<Base::Vector3f> buffer = points;
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (v_it.Begin(); v_it.More(); v_it.Next()) {
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
-
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
-
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
-
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
-
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
-
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
-
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
-
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
+        MeshCore::parallel_for(
+            std::size_t(0),
+            points.size(),
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t pos = first; pos < last; pos++) {
+                    buffer[pos] = PlaneFitPoint(adjacency, points, pos, this->maximum);
+                }
+            },
+            SmoothingThreads());
+        points.swap(buffer);
     }
+
+    AssignPoints(kernel, points);
 }
 
 void PlaneFitSmoothing::SmoothPoints(unsigned int iterations,
                                      const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    std::vector<Base::Vector3f> points = CopyPoints(kernel);
+    std::vector<Base::Vector3f> buffer = points;
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (PointIndex it : point_indices) {
-            v_it.Set(it);
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
-
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
-
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
-
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
-
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
-
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
-
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
-
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
+        MeshCore::parallel_for(
+            std::size_t(0),
+            point_indices.size(),
+            [&](std::size_t first, std::size_t last) {
+                for (std::size_t k = first; k < last; k++) {
+                    PointIndex pos = point_indices[k];
+                    buffer[pos] = PlaneFitPoint(adjacency, points, pos, this->maximum);
+                }
+            },
+            SmoothingThreads());
+        points.swap(buffer);
     }
+
+    AssignPoints(kernel, points);
 }
 
 LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
-                                double stepsize)
+void LaplaceSmoothing::Umbrella(const MeshPointAdjacency& adjacency,
+                                double stepsize,
+                                const std::vector<Base::Vector3f>& in,
+                                std::vector<Base::Vector3f>& out) const
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
-
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
-        }
-
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
-    }
+    MeshCore::parallel_for(
+        std::size_t(0),
+        in.size(),
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t pos = first; pos < last; pos++) {
+                out[pos] = UmbrellaPoint(adjacency, in, pos, stepsize);
+            }
+        },
+        SmoothingThreads());
 }
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
+void LaplaceSmoothing::Umbrella(const MeshPointAdjacency& adjacency,
                                 double stepsize,
-                                const std::vector<PointIndex>& point_indices)
+                                const std::vector<Base::Vector3f>& in,
+                                std::vector<Base::Vector3f>& out,
+                                const std::vector<PointIndex>& point_indices) const
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
-
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
-        }
-
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
-    }
+    MeshCore::parallel_for(
+        std::size_t(0),
+        point_indices.size(),
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; i++) {
+                PointIndex pos = point_indices[i];
+                out[pos] = UmbrellaPoint(adjacency, in, pos, stepsize);
+            }
+        },
+        SmoothingThreads());
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    std::vector<Base::Vector3f> points = CopyPoints(kernel);
+    std::vector<Base::Vector3f> buffer = points;
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        Umbrella(adjacency, lambda, points, buffer);
+        points.swap(buffer);
     }
+
+    AssignPoints(kernel, points);
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations,
                                     const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    std::vector<Base::Vector3f> points = CopyPoints(kernel);
+    std::vector<Base::Vector3f> buffer = points;
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(adjacency, lambda, points, buffer, point_indices);
+        points.swap(buffer);
     }
+
+    AssignPoints(kernel, points);
 }
 
 TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
@@ -270,29 +273,35 @@ TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    std::vector<Base::Vector3f> points = CopyPoints(kernel);
+    std::vector<Base::Vector3f> buffer = points;
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda());
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro));
+        Umbrella(adjacency, GetLambda(), points, buffer);
+        Umbrella(adjacency, -(GetLambda() + micro), buffer, points);
     }
+
+    AssignPoints(kernel, points);
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations,
                                    const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    std::vector<Base::Vector3f> points = CopyPoints(kernel);
+    std::vector<Base::Vector3f> buffer = points;
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda(), point_indices);
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
+        Umbrella(adjacency, GetLambda(), points, buffer, point_indices);
+        Umbrella(adjacency, -(GetLambda() + micro), buffer, points, point_indices);
     }
+
+    AssignPoints(kernel, points);
 }
 
 namespace
@@ -26,13 +26,15 @@
 #include <limits>
 #include <vector>
 
+#include <Base/Vector3D.h>
+
 #include "Definitions.h"
 
 
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
+class MeshPointAdjacency;
 class MeshRefPointToFacets;
 class MeshRefFacetToFacets;
 
@@ -107,11 +109,19 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&,
-                  double,
-                  const std::vector<PointIndex>&);
+    /// Moves the points of \a in by \a stepsize towards the center of their neighbours and
+    /// writes them to \a out.
+    void Umbrella(const MeshPointAdjacency&,
+                  double stepsize,
+                  const std::vector<Base::Vector3f>& in,
+                  std::vector<Base::Vector3f>& out) const;
+    /// Does the same as above but only for the given points, all other points of \a out must
+    /// be equal to \a in.
+    void Umbrella(const MeshPointAdjacency&,
+                  double stepsize,
+                  const std::vector<Base::Vector3f>& in,
+                  std::vector<Base::Vector3f>& out,
+                  const std::vector<PointIndex>&) const;
 
 private:
     double lambda {0.6307};
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 #endif
 
@@ -31,6 +32,7 @@
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Interpreter.h>
+#include <Base/Profiler.h>
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
@@ -38,6 +40,7 @@
 #include <Base/ViewProj.h>
 #include <Base/Writer.h>
 
+#include "Core/BVH.h"
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
@@ -61,10 +64,66 @@ const float MeshObject::Epsilon = 1.0e-5F;
 TYPESYSTEM_SOURCE(Mesh::MeshObject, Data::ComplexGeoData)
 TYPESYSTEM_SOURCE(Mesh::MeshSegment, Data::Segment)
 
-MeshObject::MeshObject() = default;
+class MeshObject::SpatialIndex
+{
+public:
+    template<class T>
+    std::shared_ptr<const T> get(std::shared_ptr<const T>& entry,
+                                 const MeshCore::MeshKernel& kernel)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // safety net if the kernel was modified without invalidating the index
+        if (points != kernel.CountPoints() || facets != kernel.CountFacets()) {
+            reset();
+            points = kernel.CountPoints();
+            facets = kernel.CountFacets();
+        }
+        if (entry) {
+            stats.hits++;
+        }
+        else {
+            entry = std::make_shared<const T>(kernel);
+            stats.rebuilds++;
+        }
+        return entry;
+    }
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reset();
+        stats.version++;
+    }
+    SpatialIndexStatistics statistics()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    std::shared_ptr<const MeshCore::MeshFacetGrid> facetGrid;
+    std::shared_ptr<const MeshCore::MeshPointGrid> pointGrid;
+    std::shared_ptr<const MeshCore::MeshFacetBVH> facetBVH;
+
+private:
+    void reset()
+    {
+        facetGrid.reset();
+        pointGrid.reset();
+        facetBVH.reset();
+    }
+
+    std::mutex mutex;
+    unsigned long points {0};
+    unsigned long facets {0};
+    SpatialIndexStatistics stats;
+};
+
+MeshObject::MeshObject()
+    : _index(std::make_unique<SpatialIndex>())
+{}
 
 MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel)  // NOLINT
     : _kernel(Kernel)
+    , _index(std::make_unique<SpatialIndex>())
 {
     // copy the mesh structure
 }
@@ -72,6 +131,7 @@ MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel)  // NOLINT
 MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel, const Base::Matrix4D& Mtrx)  // NOLINT
     : _Mtrx(Mtrx)
     , _kernel(Kernel)
+    , _index(std::make_unique<SpatialIndex>())
 {
     // copy the mesh structure
 }
@@ -79,6 +139,7 @@ MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel, const Base::Matrix4D&
 MeshObject::MeshObject(const MeshObject& mesh)
     : _Mtrx(mesh._Mtrx)
     , _kernel(mesh._kernel)
+    , _index(std::make_unique<SpatialIndex>())
 {
     // copy the mesh structure
     copySegments(mesh);
@@ -87,6 +148,7 @@ MeshObject::MeshObject(const MeshObject& mesh)
 MeshObject::MeshObject(MeshObject&& mesh)
     : _Mtrx(mesh._Mtrx)
     , _kernel(mesh._kernel)
+    , _index(std::make_unique<SpatialIndex>())
 {
     // copy the mesh structure
     copySegments(mesh);
@@ -156,6 +218,7 @@ void MeshObject::getFacesFromSubElement(const Data::Segment* element,
 
 void MeshObject::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshKernel kernel;
     swap(kernel);
     kernel.Transform(rclMat);
@@ -220,6 +283,7 @@ MeshObject& MeshObject::operator=(const MeshObject& mesh)
     if (this != &mesh) {
         // copy the mesh structure
         setTransform(mesh._Mtrx);
+        invalidateSpatialIndex();
         this->_kernel = mesh._kernel;
         copySegments(mesh);
     }
@@ -232,6 +296,7 @@ MeshObject& MeshObject::operator=(MeshObject&& mesh)
     if (this != &mesh) {
         // copy the mesh structure
         setTransform(mesh._Mtrx);
+        invalidateSpatialIndex();
         this->_kernel = mesh._kernel;
         copySegments(mesh);
     }
@@ -241,12 +306,14 @@ MeshObject& MeshObject::operator=(MeshObject&& mesh)
 
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
+    invalidateSpatialIndex();
     this->_kernel = m;
     this->_segments.clear();
 }
 
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
+    invalidateSpatialIndex();
     this->_kernel.Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
@@ -255,6 +322,8 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
+    invalidateSpatialIndex();
+    mesh.invalidateSpatialIndex();
     this->_kernel.Swap(mesh._kernel);
     swapSegments(mesh);
     Base::Matrix4D tmp = this->_Mtrx;
@@ -262,6 +331,31 @@ void MeshObject::swap(MeshObject& mesh)
     mesh._Mtrx = tmp;
 }
 
+std::shared_ptr<const MeshCore::MeshFacetGrid> MeshObject::getFacetGrid() const
+{
+    return _index->get(_index->facetGrid, _kernel);
+}
+
+std::shared_ptr<const MeshCore::MeshPointGrid> MeshObject::getPointGrid() const
+{
+    return _index->get(_index->pointGrid, _kernel);
+}
+
+std::shared_ptr<const MeshCore::MeshFacetBVH> MeshObject::getFacetBVH() const
+{
+    return _index->get(_index->facetBVH, _kernel);
+}
+
+void MeshObject::invalidateSpatialIndex()
+{
+    _index->invalidate();
+}
+
+MeshObject::SpatialIndexStatistics MeshObject::getSpatialIndexStatistics() const
+{
+    return _index->statistics();
+}
+
 std::string MeshObject::representation() const
 {
     std::stringstream str;
@@ -389,6 +483,7 @@ void MeshObject::Restore(Base::XMLReader& /*reader*/)
 
 void MeshObject::RestoreDocFile(Base::Reader& reader)
 {
+    invalidateSpatialIndex();
     load(reader);
 }
 
@@ -397,6 +492,8 @@ void MeshObject::save(const char* file,
                       const MeshCore::Material* mat,
                       const char* objectname) const
 {
+    ZoneScoped;
+
     MeshCore::MeshOutput aWriter(this->_kernel, mat);
     if (objectname) {
         aWriter.SetObjectName(objectname);
@@ -428,6 +525,8 @@ void MeshObject::save(std::ostream& str,
                       const MeshCore::Material* mat,
                       const char* objectname) const
 {
+    ZoneScoped;
+
     MeshCore::MeshOutput aWriter(this->_kernel, mat);
     if (objectname) {
         aWriter.SetObjectName(objectname);
@@ -452,6 +551,9 @@ void MeshObject::save(std::ostream& str,
 
 bool MeshObject::load(const char* file, MeshCore::Material* mat)
 {
+    invalidateSpatialIndex();
+    ZoneScoped;
+
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadAny(file)) {
@@ -464,6 +566,9 @@ bool MeshObject::load(const char* file, MeshCore::Material* mat)
 
 bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::Material* mat)
 {
+    invalidateSpatialIndex();
+    ZoneScoped;
+
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadFormat(str, f)) {
@@ -476,7 +581,9 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g)
 {
+    invalidateSpatialIndex();
     _kernel.Swap(kernel);
+    TracyPlot("Mesh kernel memory", static_cast<int64_t>(_kernel.GetMemSize()));
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
     // the object into its original objects again.
@@ -514,12 +621,16 @@ void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std:
 
 void MeshObject::save(std::ostream& out) const
 {
+    ZoneScoped;
     _kernel.Write(out);
 }
 
 void MeshObject::load(std::istream& in)
 {
+    invalidateSpatialIndex();
+    ZoneScoped;
     _kernel.Read(in);
+    TracyPlot("Mesh kernel memory", static_cast<int64_t>(_kernel.GetMemSize()));
     this->_segments.clear();
 
 #ifndef FC_DEBUG
@@ -573,16 +684,19 @@ void MeshObject::writeInventor(std::ostream& str, float creaseangle) const
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
+    invalidateSpatialIndex();
     _kernel.AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    invalidateSpatialIndex();
     _kernel.AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets, bool checkManifolds)
 {
+    invalidateSpatialIndex();
     _kernel.AddFacets(facets, checkManifolds);
 }
 
@@ -590,6 +704,7 @@ void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
+    invalidateSpatialIndex();
     _kernel.AddFacets(facets, points, checkManifolds);
 }
 
@@ -597,6 +712,7 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
                            const std::vector<Base::Vector3d>& points,
                            bool checkManifolds)
 {
+    invalidateSpatialIndex();
     std::vector<MeshCore::MeshFacet> facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -619,12 +735,14 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    invalidateSpatialIndex();
     _kernel = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facets,
                            const std::vector<Base::Vector3d>& points)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshFacetArray facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -647,16 +765,19 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
+    invalidateSpatialIndex();
     _kernel.Merge(mesh._kernel);
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
+    invalidateSpatialIndex();
     _kernel.Merge(kernel);
 }
 
 void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 {
+    invalidateSpatialIndex();
     if (removeIndices.empty()) {
         return;
     }
@@ -666,6 +787,7 @@ void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 
 void MeshObject::deletePoints(const std::vector<PointIndex>& removeIndices)
 {
+    invalidateSpatialIndex();
     if (removeIndices.empty()) {
         return;
     }
@@ -715,6 +837,7 @@ void MeshObject::deletedFacets(const std::vector<FacetIndex>& remFacets)
 
 void MeshObject::deleteSelectedFacets()
 {
+    invalidateSpatialIndex();
     std::vector<FacetIndex> facets;
     MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
     deleteFacets(facets);
@@ -722,6 +845,7 @@ void MeshObject::deleteSelectedFacets()
 
 void MeshObject::deleteSelectedPoints()
 {
+    invalidateSpatialIndex();
     std::vector<PointIndex> points;
     MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
     deletePoints(points);
@@ -810,7 +934,7 @@ bool MeshObject::nearestFacetOnRay(const MeshObject::TRay& ray,
     Base::Vector3f res;
     MeshCore::MeshAlgorithm alg(getKernel());
 
-    if (alg.NearestFacetOnRay(pnt, dir, static_cast<float>(maxAngle), res, index)) {
+    if (alg.NearestFacetOnRay(pnt, dir, static_cast<float>(maxAngle), *getFacetBVH(), res, index)) {
         plm.multVec(res, res);
         output.first = index;
         output.second = Base::toVector<double>(res);
@@ -832,13 +956,15 @@ std::vector<MeshObject::TFaceSection> MeshObject::foraminate(const TRay& ray, do
     inv.multVec(pnt, pnt);
     inv.getRotation().multVec(dir, dir);
 
-    Base::Vector3f res;
-    MeshCore::MeshFacetIterator f_it(getKernel());
-    int index = 0;
+    // only test the facets whose bounding boxes are hit by the ray
+    std::vector<FacetIndex> facets;
+    getFacetBVH()->OnLine(pnt, dir, facets);
+    std::sort(facets.begin(), facets.end());
 
+    Base::Vector3f res;
     std::vector<MeshObject::TFaceSection> output;
-    for (f_it.Begin(); f_it.More(); f_it.Next(), index++) {
-        if (f_it->Foraminate(pnt, dir, res, static_cast<float>(maxAngle))) {
+    for (FacetIndex index : facets) {
+        if (_kernel.GetFacet(index).Foraminate(pnt, dir, res, static_cast<float>(maxAngle))) {
             plm.multVec(res, res);
 
             MeshObject::TFaceSection section;
@@ -892,6 +1018,7 @@ unsigned long MeshObject::countComponents() const
 
 void MeshObject::removeComponents(unsigned long count)
 {
+    invalidateSpatialIndex();
     std::vector<FacetIndex> removeIndices;
     MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
     _kernel.DeleteFacets(removeIndices);
@@ -929,6 +1056,7 @@ void MeshObject::fillupHoles(unsigned long length,
                              int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
+    invalidateSpatialIndex();
     std::list<std::vector<PointIndex>> aFailed;
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.FillupHoles(length, level, cTria, aFailed);
@@ -936,6 +1064,7 @@ void MeshObject::fillupHoles(unsigned long length,
 
 void MeshObject::offset(float fSize)
 {
+    invalidateSpatialIndex();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -949,6 +1078,7 @@ void MeshObject::offset(float fSize)
 
 void MeshObject::offsetSpecial2(float fSize)
 {
+    invalidateSpatialIndex();
     Base::Builder3D builder;
     std::vector<Base::Vector3f> PointNormals = _kernel.CalcVertexNormals();
     std::vector<Base::Vector3f> FaceNormals;
@@ -1015,6 +1145,7 @@ void MeshObject::offsetSpecial2(float fSize)
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
+    invalidateSpatialIndex();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -1034,6 +1165,7 @@ void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 
 void MeshObject::clear()
 {
+    invalidateSpatialIndex();
     _kernel.Clear();
     this->_segments.clear();
     setTransform(Base::Matrix4D());
@@ -1041,6 +1173,7 @@ void MeshObject::clear()
 
 void MeshObject::transformToEigenSystem()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshEigensystem cMeshEval(_kernel);
     cMeshEval.Evaluate();
     this->setTransform(cMeshEval.Transform());
@@ -1057,6 +1190,7 @@ Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
 
 void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 {
+    invalidateSpatialIndex();
     // v is a vector, hence we must not apply the translation part
     // of the transformation to the vector
     Base::Vector3d vec(v);
@@ -1068,26 +1202,37 @@ void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 
 void MeshObject::setPoint(PointIndex index, const Base::Vector3d& p)
 {
+    invalidateSpatialIndex();
     _kernel.SetPoint(index, transformPointToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
+    invalidateSpatialIndex();
     _kernel.Smooth(iterations, d_max);
 }
 
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshSimplify dm(this->_kernel);
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshSimplify dm(this->_kernel);
     dm.simplify(targetSize);
 }
 
+void MeshObject::decimateParallel(int targetSize, float maxError)
+{
+    invalidateSpatialIndex();
+    MeshCore::MeshSimplify dm(this->_kernel);
+    dm.simplifyParallel(targetSize, maxError);
+}
+
 Base::Vector3d MeshObject::getPointNormal(PointIndex index) const
 {
     std::vector<Base::Vector3f> temp = _kernel.CalcVertexNormals();
@@ -1128,6 +1273,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj,
                      MeshObject::CutType type)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1158,6 +1304,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj,
                       MeshObject::CutType type)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1206,9 +1353,9 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
     meshPlacement.multVec(base, basePlane);
     meshPlacement.getRotation().multVec(normal, normalPlane);
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
-    trim.CheckFacets(meshGrid, basePlane, normalPlane, trimFacets, removeFacets);
+    trim.CheckFacets(*getFacetGrid(), basePlane, normalPlane, trimFacets, removeFacets);
     trim.TrimFacets(trimFacets, basePlane, normalPlane, triangle);
+    invalidateSpatialIndex();
     if (!removeFacets.empty()) {
         this->deleteFacets(removeFacets);
     }
@@ -1338,6 +1485,7 @@ MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) c
 
 void MeshObject::refine()
 {
+    invalidateSpatialIndex();
     unsigned long cnt = _kernel.CountFacets();
     MeshCore::MeshFacetIterator cF(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
@@ -1357,6 +1505,7 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshRemoveNeedles eval(_kernel, length);
     eval.Fixup();
@@ -1367,12 +1516,14 @@ void MeshObject::removeNeedles(float length)
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     if (fMaxAngle > 0.0F) {
         topalg.OptimizeTopology(fMaxAngle);
@@ -1388,12 +1539,14 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
+    invalidateSpatialIndex();
     std::vector<std::pair<FacetIndex, FacetIndex>> adjacentFacet;
     MeshCore::MeshAlgorithm alg(_kernel);
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
@@ -1426,24 +1579,28 @@ void MeshObject::splitEdges()
 
 void MeshObject::splitEdge(FacetIndex facet, FacetIndex neighbour, const Base::Vector3f& v)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitEdge(facet, neighbour, v);
 }
 
 void MeshObject::splitFacet(FacetIndex facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitFacet(facet, v1, v2);
 }
 
 void MeshObject::swapEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SwapEdge(facet, neighbour);
 }
 
 void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseEdge(facet, neighbour);
 
@@ -1455,6 +1612,7 @@ void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 
 void MeshObject::collapseFacet(FacetIndex facet)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseFacet(facet);
 
@@ -1465,6 +1623,7 @@ void MeshObject::collapseFacet(FacetIndex facet)
 
 void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     for (FacetIndex it : facets) {
         alg.CollapseFacet(it);
@@ -1475,12 +1634,14 @@ void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 
 void MeshObject::insertVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.InsertVertex(facet, v);
 }
 
 void MeshObject::snapVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SnapVertex(facet, v);
 }
@@ -1494,12 +1655,14 @@ unsigned long MeshObject::countNonUniformOrientedFacets() const
 
 void MeshObject::flipNormals()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.FlipNormals();
 }
 
 void MeshObject::harmonizeNormals()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.HarmonizeNormals();
 }
@@ -1512,6 +1675,7 @@ bool MeshObject::hasNonManifolds() const
 
 void MeshObject::removeNonManifolds()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshEvalTopology f_eval(_kernel);
     if (!f_eval.Evaluate()) {
         MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
@@ -1522,6 +1686,7 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshEvalPointManifolds p_eval(_kernel);
     if (!p_eval.Evaluate()) {
         std::vector<FacetIndex> faces;
@@ -1532,13 +1697,13 @@ void MeshObject::removeNonManifoldPoints()
 
 bool MeshObject::hasSelfIntersections() const
 {
-    MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
+    MeshCore::MeshEvalSelfIntersection cMeshEval(*getFacetBVH());
     return !cMeshEval.Evaluate();
 }
 
 MeshObject::TFacePairs MeshObject::getSelfIntersections() const
 {
-    MeshCore::MeshEvalSelfIntersection eval(getKernel());
+    MeshCore::MeshEvalSelfIntersection eval(*getFacetBVH());
     MeshObject::TFacePairs pairs;
     eval.GetIntersections(pairs);
     return pairs;
@@ -1569,8 +1734,9 @@ MeshObject::getSelfIntersections(const MeshObject::TFacePairs& facets) const
 void MeshObject::removeSelfIntersections()
 {
     std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
-    MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
+    MeshCore::MeshEvalSelfIntersection cMeshEval(*getFacetBVH());
     cMeshEval.GetIntersections(selfIntersections);
+    invalidateSpatialIndex();
 
     if (!selfIntersections.empty()) {
         MeshCore::MeshFixSelfIntersection cMeshFix(_kernel, selfIntersections);
@@ -1580,6 +1746,7 @@ void MeshObject::removeSelfIntersections()
 
 void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 {
+    invalidateSpatialIndex();
     // make sure that the number of indices is even and are in range
     if (indices.size() % 2 != 0) {
         return;
@@ -1612,6 +1779,7 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 
 void MeshObject::removeFoldsOnSurface()
 {
+    invalidateSpatialIndex();
     std::vector<FacetIndex> indices;
     MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
     MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
@@ -1646,6 +1814,7 @@ void MeshObject::removeFoldsOnSurface()
 
 void MeshObject::removeFullBoundaryFacets()
 {
+    invalidateSpatialIndex();
     std::vector<FacetIndex> facets;
     if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
         deleteFacets(facets);
@@ -1660,6 +1829,7 @@ bool MeshObject::hasInvalidPoints() const
 
 void MeshObject::removeInvalidPoints()
 {
+    invalidateSpatialIndex();
     MeshCore::MeshEvalNaNPoints nan(_kernel);
     deletePoints(nan.GetIndices());
 }
@@ -1672,12 +1842,14 @@ bool MeshObject::hasPointsOnEdge() const
 
 void MeshObject::removePointsOnEdge(bool fillBoundary)
 {
+    invalidateSpatialIndex();
     MeshCore::MeshFixPointOnEdge nan(_kernel, fillBoundary);
     nan.Fixup();
 }
 
 void MeshObject::mergeFacets()
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixMergeFacets merge(_kernel);
     merge.Fixup();
@@ -1688,6 +1860,7 @@ void MeshObject::mergeFacets()
 
 void MeshObject::validateIndices()
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
 
     // for invalid neighbour indices we don't need to check first
@@ -1744,6 +1917,7 @@ bool MeshObject::hasCorruptedFacets() const
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDeformedFacets eval(_kernel,
                                          Base::toRadians(15.0F),
@@ -1758,6 +1932,7 @@ void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 
 void MeshObject::validateDegenerations(float fEps)
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
     eval.Fixup();
@@ -1768,6 +1943,7 @@ void MeshObject::validateDegenerations(float fEps)
 
 void MeshObject::removeDuplicatedPoints()
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicatePoints eval(_kernel);
     eval.Fixup();
@@ -1778,6 +1954,7 @@ void MeshObject::removeDuplicatedPoints()
 
 void MeshObject::removeDuplicatedFacets()
 {
+    invalidateSpatialIndex();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicateFacets eval(_kernel);
     eval.Fixup();
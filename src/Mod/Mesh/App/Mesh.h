@@ -25,6 +25,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -58,6 +59,9 @@ class ViewProjMethod;
 namespace MeshCore
 {
 class AbstractPolygonTriangulator;
+class MeshFacetBVH;
+class MeshFacetGrid;
+class MeshPointGrid;
 }
 
 namespace Mesh
@@ -176,8 +180,10 @@ public:
     //@}
 
     void setKernel(const MeshCore::MeshKernel& m);
+    /// Returns the kernel for modification, this drops the cached spatial index
     MeshCore::MeshKernel& getKernel()
     {
+        invalidateSpatialIndex();
         return _kernel;
     }
     const MeshCore::MeshKernel& getKernel() const
@@ -185,6 +191,29 @@ public:
         return _kernel;
     }
 
+    /** @name Spatial index
+     * The search structures of the untransformed mesh data are built on first use and
+     * shared by all algorithms until the mesh is modified. The returned objects refer to the
+     * kernel and must not be used after the mesh was modified or destroyed.
+     */
+    //@{
+    struct SpatialIndexStatistics
+    {
+        /// number of requests served from the cache
+        unsigned long hits {0};
+        /// number of search structures that had to be built
+        unsigned long rebuilds {0};
+        /// incremented every time the mesh is modified
+        unsigned long version {0};
+    };
+    std::shared_ptr<const MeshCore::MeshFacetGrid> getFacetGrid() const;
+    std::shared_ptr<const MeshCore::MeshPointGrid> getPointGrid() const;
+    std::shared_ptr<const MeshCore::MeshFacetBVH> getFacetBVH() const;
+    /// Must be called after the kernel has been modified directly
+    void invalidateSpatialIndex();
+    SpatialIndexStatistics getSpatialIndexStatistics() const;
+    //@}
+
     Base::BoundBox3d getBoundBox() const override;
     bool getCenterOfGravity(Base::Vector3d& center) const override;
 
@@ -264,6 +293,8 @@ public:
     void smooth(int iterations, float d_max);
     void decimate(float fTolerance, float fReduction);
     void decimate(int targetSize);
+    /// Multi-threaded decimation that limits the error of each edge collapse to \a maxError
+    void decimateParallel(int targetSize, float maxError);
     Base::Vector3d getPointNormal(PointIndex) const;
     std::vector<Base::Vector3d> getPointNormals() const;
     void crossSections(const std::vector<TPlane>&,
@@ -468,9 +499,12 @@ private:
     void swapSegments(MeshObject&);
 
 private:
+    class SpatialIndex;
+
     Base::Matrix4D _Mtrx;
     MeshCore::MeshKernel _kernel;
     std::vector<Segment> _segments;
+    std::unique_ptr<SpatialIndex> _index;
     static const float Epsilon;
 };
 
@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 
+#include <App/Application.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Reader.h>
@@ -888,8 +889,13 @@ void PropertyMeshKernel::Save(Base::Writer& writer) const
         saver.SaveXML(writer);
     }
     else {
-        writer.Stream() << writer.ind() << "<Mesh file=\"" << writer.addFile("MeshKernel.bms", this)
-                        << "\"/>" << std::endl;
+        // Binary mesh data doesn't compress well, so by default it's stored as is to save
+        // the time for (de)compressing large meshes
+        bool compress = App::GetApplication()
+                            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Mesh")
+                            ->GetBool("CompressDocFile", false);
+        writer.Stream() << writer.ind() << "<Mesh file=\""
+                        << writer.addFile("MeshKernel.bms", this, compress) << "\"/>" << std::endl;
     }
 }
 
@@ -931,6 +937,23 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+void PropertyMeshKernel::readDocFile(Base::Reader& reader)
+{
+    Base::Reference<MeshObject> mesh(new MeshObject());
+    mesh->load(reader);
+    _restoredMesh = mesh;
+}
+
+void PropertyMeshKernel::finishRestoreDocFile()
+{
+    if (_restoredMesh.isValid()) {
+        aboutToSetValue();
+        _meshObject->swap(_restoredMesh->getKernel());
+        hasSetValue();
+        _restoredMesh = nullptr;
+    }
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
     // Note: Copy the content, do NOT reference the same mesh object
@@ -315,6 +315,12 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileConcurrently() const override
+    {
+        return true;
+    }
+    void readDocFile(Base::Reader& reader) override;
+    void finishRestoreDocFile() override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
@@ -322,6 +328,8 @@ public:
 
 private:
     Base::Reference<MeshObject> _meshObject;
+    // mesh read by readDocFile() and not yet applied
+    Base::Reference<MeshObject> _restoredMesh;
     MeshPy* meshPyObject {nullptr};
 };
 
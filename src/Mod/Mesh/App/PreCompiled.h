@@ -47,16 +47,21 @@
 
 // STL
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <list>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <vector>
 
 // boost
@@ -1611,9 +1611,9 @@ void ViewProviderMesh::splitMesh(const MeshCore::MeshKernel& toolMesh,
 
     // Get the facet indices inside the tool mesh
     std::vector<Mesh::FacetIndex> indices;
-    MeshCore::MeshFacetGrid cGrid(meshPropKernel);
+    std::shared_ptr<const MeshCore::MeshFacetGrid> cGrid = meshProp.getValue().getFacetGrid();
     MeshCore::MeshAlgorithm cAlg(meshPropKernel);
-    cAlg.GetFacetsFromToolMesh(toolMesh, normal, cGrid, indices);
+    cAlg.GetFacetsFromToolMesh(toolMesh, normal, *cGrid, indices);
     if (!clip_inner) {
         // get the indices that are completely outside
         std::vector<Mesh::FacetIndex> complete(meshPropKernel.CountFacets());
@@ -1646,9 +1646,9 @@ void ViewProviderMesh::segmentMesh(const MeshCore::MeshKernel& toolMesh,
 
     // Get the facet indices inside the tool mesh
     std::vector<Mesh::FacetIndex> indices;
-    MeshCore::MeshFacetGrid cGrid(meshPropKernel);
+    std::shared_ptr<const MeshCore::MeshFacetGrid> cGrid = meshProp.getValue().getFacetGrid();
     MeshCore::MeshAlgorithm cAlg(meshPropKernel);
-    cAlg.GetFacetsFromToolMesh(toolMesh, normal, cGrid, indices);
+    cAlg.GetFacetsFromToolMesh(toolMesh, normal, *cGrid, indices);
     if (!clip_inner) {
         // get the indices that are completely outside
         std::vector<Mesh::FacetIndex> complete(meshPropKernel.CountFacets());
@@ -82,6 +82,12 @@ App::DocumentObjectExecReturn* Primitive::execute() {
     return Part::Feature::execute();
 }
 
+bool Primitive::canRecomputeConcurrently() const
+{
+    // An attached primitive reads (and may cache) the shape of its support
+    return !isAttacherActive();
+}
+
 // suppress warning about tp_print for Py3.8
 #if defined(__clang__)
 # pragma clang diagnostic push
@@ -23,7 +23,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <atomic>
+# include <iterator>
 # include <sstream>
+# include <thread>
 # include <Bnd_Box.hxx>
 # include <BRepBndLib.hxx>
 # include <BRepBuilderAPI_Copy.hxx>
@@ -35,6 +39,9 @@
 # include <TopoDS.hxx>
 #endif // _PreComp_
 
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
@@ -66,6 +73,8 @@ PropertyPartShape::~PropertyPartShape() = default;
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
     aboutToSetValue();
+    _PendingShape = {};
+    _HasPendingShape = false;
     _Shape = sh;
     auto obj = freecad_cast<App::DocumentObject*>(getContainer());
     if(obj) {
@@ -87,6 +96,8 @@ void PropertyPartShape::setValue(const TopoShape& sh)
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
     aboutToSetValue();
+    _PendingShape = {};
+    _HasPendingShape = false;
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if(obj)
         _Shape.Tag = obj->getID();
@@ -97,11 +108,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    loadPendingShape();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    loadPendingShape();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -118,6 +131,7 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    loadPendingShape();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
@@ -125,6 +139,7 @@ const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
     Base::BoundBox3d box;
+    loadPendingShape();
     if (_Shape.getShape().IsNull())
         return box;
     try {
@@ -150,16 +165,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D &rclTrf)
 {
+    loadPendingShape();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    loadPendingShape();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 {
+    loadPendingShape();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -167,6 +185,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 
 PyObject *PropertyPartShape::getPyObject()
 {
+    loadPendingShape();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop)
         prop->setConst();
@@ -204,6 +223,7 @@ void PropertyPartShape::setPyObject(PyObject *value)
 App::Property *PropertyPartShape::Copy() const
 {
     PropertyPartShape *prop = new PropertyPartShape();
+    loadPendingShape();
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
     // copy ( new geometry and map ) that has not been kept:
@@ -221,6 +241,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 {
     auto prop = freecad_cast<const PropertyPartShape*>(&from);
     if(prop) {
+        prop->loadPendingShape();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -228,6 +249,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 
 unsigned int PropertyPartShape::getMemSize () const
 {
+    loadPendingShape();
     return _Shape.getMemSize();
 }
 
@@ -247,6 +269,7 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) cons
 
 void PropertyPartShape::beforeSave() const
 {
+    loadPendingShape();
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
@@ -260,6 +283,7 @@ void PropertyPartShape::beforeSave() const
 void PropertyPartShape::Save (Base::Writer &writer) const
 {
     //See SaveDocFile(), RestoreDocFile()
+    loadPendingShape();
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if(owner && !_Shape.isNull()
@@ -322,6 +346,8 @@ std::string PropertyPartShape::getElementMapVersion(bool restored) const {
 void PropertyPartShape::Restore(Base::XMLReader &reader)
 {
     reader.readElement("Part");
+    _PendingShape = {};
+    _HasPendingShape = false;
 
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
     _Ver = "?";
@@ -419,6 +445,21 @@ void PropertyPartShape::afterRestore()
         if (_Shape.Hasher)
             _Shape.Hasher->clear();
     }
+
+    if (_PendingShape.valid()) {
+        // PropertyComplexGeoData::afterRestore() would parse a lazily restored shape
+        // via getComplexData() while only the element map that is already there is needed
+        if (_Shape.isRestoreFailed()) {
+            _Shape.resetRestoreFailure();
+            auto owner = freecad_cast<App::DocumentObject*>(getContainer());
+            if (owner && owner->getDocument()
+                && !owner->getDocument()->testStatus(App::Document::PartialDoc)) {
+                owner->getDocument()->addRecomputeObject(owner);
+            }
+        }
+        App::PropertyGeometry::afterRestore();
+        return;
+    }
     PropertyComplexGeoData::afterRestore();
 }
 
@@ -504,7 +545,7 @@ void PropertyPartShape::saveToFile(Base::Writer &writer) const
     fi.deleteFile();
 }
 
-void PropertyPartShape::loadFromFile(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadFromFile(Base::Reader &reader)
 {
     BRep_Builder builder;
     // create a temporary file and copy the content from the zip stream
@@ -544,28 +585,29 @@ void PropertyPartShape::loadFromFile(Base::Reader &reader)
 
     // delete the temp file
     fi.deleteFile();
-    setValue(shape);
+    return shape;
 }
 
-void PropertyPartShape::loadFromStream(Base::Reader &reader)
+TopoDS_Shape PropertyPartShape::loadFromStream(Base::Reader &reader)
 {
+    TopoDS_Shape shape;
     try {
         reader.exceptions(std::istream::failbit | std::istream::badbit);
         BRep_Builder builder;
-        TopoDS_Shape shape;
         BRepTools::Read(shape, reader, builder);
-        setValue(shape);
     }
     catch (const std::exception&) {
         if (!reader.eof())
             Base::Console().Warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
     }
+    return shape;
 }
 
 void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 {
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
+    loadPendingShape();
     if (_Shape.getShape().IsNull())
         return;
     TopoDS_Shape myShape = _Shape.getShape();
@@ -588,41 +630,78 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     }
 }
 
-void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
+static bool isDirectAccess()
 {
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+}
 
-    // save the element map
-    auto elementMap = _Shape.resetElementMap();
-    auto hasher = _Shape.Hasher;
+static bool isLazyLoad()
+{
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("LazyLoad", false);
+}
 
-    Base::FileInfo brep(reader.getFileName());
-    TopoShape shape;
+static bool isLazyLoadPrefetch()
+{
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("LazyLoadPrefetch", true);
+}
 
-    // In LS3 the following statement is executed right before shape.Hasher = hasher;
-    // https://github.com/realthunder/FreeCAD/blob/a9810d509a6f112b5ac03d4d4831b67e6bffd5b7/src/Mod/Part/App/PropertyTopoShape.cpp#L639
-    // Now it's not possible anymore because both PropertyPartShape::loadFromFile() and
-    // PropertyPartShape::loadFromStream() calls PropertyPartShape::setValue() which clears the
-    // value of _Ver.
-    // Therefore we're storing the value of _Ver here so that we don't lose it.
+// number of lazily restored shapes currently parsed in the background
+static std::atomic<unsigned int> prefetchCount {0};
 
-    std::string ver = _Ver;
+static TopoShape parsePendingShape(const std::string& data, bool binary, const std::string& name)
+{
+    boost::iostreams::stream<boost::iostreams::array_source> str(data.data(), data.size());
+    TopoShape shape;
+    try {
+        if (binary) {
+            shape.importBinary(str);
+        }
+        else {
+            shape.importBrep(str);
+        }
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().Warning("Failed to load shape of %s: %s\n", name.c_str(), e.what());
+    }
+    catch (const Standard_Failure& e) {
+        Base::Console().Warning("Failed to load shape of %s: %s\n", name.c_str(), e.GetMessageString());
+    }
+    return shape;
+}
+
+TopoShape PropertyPartShape::loadShape(Base::Reader &reader, bool direct)
+{
+    Base::FileInfo brep(reader.getFileName());
+    TopoShape shape;
 
     if (brep.hasExtension("bin")) {
         shape.importBinary(reader);
     }
+    else if (!direct) {
+        shape.setShape(loadFromFile(reader));
+    }
     else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
-        if (!direct) {
-            loadFromFile(reader);
-        }
-        else {
-            auto iostate = reader.exceptions();
-            loadFromStream(reader);
-            reader.exceptions(iostate);
-        }
-        shape = getValue();
+        auto iostate = reader.exceptions();
+        shape.setShape(loadFromStream(reader));
+        reader.exceptions(iostate);
     }
+    return shape;
+}
+
+void PropertyPartShape::setRestoredShape(TopoShape shape)
+{
+    // save the element map
+    auto elementMap = _Shape.resetElementMap();
+    auto hasher = _Shape.Hasher;
+
+    // In LS3 the value of _Ver is saved right before shape.Hasher = hasher;
+    // https://github.com/realthunder/FreeCAD/blob/a9810d509a6f112b5ac03d4d4831b67e6bffd5b7/src/Mod/Part/App/PropertyTopoShape.cpp#L639
+    // PropertyPartShape::setValue() clears the value of _Ver. Therefore we're
+    // storing the value of _Ver here so that we don't lose it.
+    std::string ver = _Ver;
 
     // restore the element map
     shape.Hasher = hasher;
@@ -631,6 +710,97 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     _Ver = ver;
 }
 
+void PropertyPartShape::setPendingShape(std::shared_ptr<const std::string> data, bool binary)
+{
+    // If the file is empty the stored shape was already empty
+    if (data->empty()) {
+        return;
+    }
+
+    if (auto owner = freecad_cast<App::DocumentObject*>(getContainer())) {
+        _Shape.Tag = owner->getID();
+    }
+
+    auto parse = [data, binary, name = getFullName()]() {
+        return parsePendingShape(*data, binary, name);
+    };
+
+    // Parse in the background as long as there are idle cores, otherwise the shape is
+    // parsed by the thread that accesses it first
+    unsigned int cores = std::max(1U, std::thread::hardware_concurrency());
+    if (isLazyLoadPrefetch() && prefetchCount < cores) {
+        ++prefetchCount;
+        _PendingShape = std::async(std::launch::async, [parse]() {
+            TopoShape shape = parse();
+            --prefetchCount;
+            return shape;
+        }).share();
+    }
+    else {
+        _PendingShape = std::async(std::launch::deferred, parse).share();
+    }
+    _HasPendingShape = true;
+}
+
+void PropertyPartShape::loadPendingShape() const
+{
+    if (!_HasPendingShape) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_PendingMutex);
+    if (!_PendingShape.valid()) {
+        // parsed by another thread meanwhile
+        return;
+    }
+
+    TopoShape shape = _PendingShape.get();
+    _PendingShape = {};
+
+    // keep the element map and tag that were restored with the document, this is what
+    // setRestoredShape() does but without notifying the container because from its point
+    // of view the value doesn't change
+    shape.Hasher = _Shape.Hasher;
+    shape.resetElementMap(_Shape.resetElementMap());
+    shape.Tag = _Shape.Tag;
+    _Shape = shape;
+    _HasPendingShape = false;
+}
+
+void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
+{
+    if (isLazyLoad()) {
+        // keep the raw data and parse it on first access
+        Base::FileInfo brep(reader.getFileName());
+        auto data = std::make_shared<const std::string>(std::istreambuf_iterator<char>(reader),
+                                                        std::istreambuf_iterator<char>());
+        setPendingShape(std::move(data), brep.hasExtension("bin"));
+        return;
+    }
+
+    setRestoredShape(loadShape(reader, isDirectAccess()));
+}
+
+bool PropertyPartShape::canRestoreDocFileConcurrently() const
+{
+    // reading via a temporary file is not safe to run concurrently, and a lazy
+    // restore only copies the data
+    return isDirectAccess() && !isLazyLoad();
+}
+
+void PropertyPartShape::readDocFile(Base::Reader &reader)
+{
+    _RestoredShape = std::make_unique<TopoShape>(loadShape(reader, true));
+}
+
+void PropertyPartShape::finishRestoreDocFile()
+{
+    if (_RestoredShape) {
+        std::unique_ptr<TopoShape> shape;
+        shape.swap(_RestoredShape);
+        setRestoredShape(*shape);
+    }
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(BRepBuilderAPI_MakeShape& mkShape, TopAbs_ShapeEnum type,
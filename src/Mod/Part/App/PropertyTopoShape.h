@@ -23,7 +23,12 @@
 #ifndef PART_PROPERTYTOPOSHAPE_H
 #define PART_PROPERTYTOPOSHAPE_H
 
+#include <atomic>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include <App/PropertyGeo.h>
@@ -90,6 +95,9 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    bool canRestoreDocFileConcurrently() const override;
+    void readDocFile(Base::Reader &reader) override;
+    void finishRestoreDocFile() override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
@@ -108,12 +116,24 @@ public:
 
 private:
     void saveToFile(Base::Writer &writer) const;
-    void loadFromFile(Base::Reader &reader);
-    void loadFromStream(Base::Reader &reader);
+    TopoDS_Shape loadFromFile(Base::Reader &reader);
+    TopoDS_Shape loadFromStream(Base::Reader &reader);
+    TopoShape loadShape(Base::Reader &reader, bool direct);
+    void setRestoredShape(TopoShape shape);
+    void setPendingShape(std::shared_ptr<const std::string> data, bool binary);
+    void loadPendingShape() const;
 
 private:
-    TopoShape _Shape;
+    // mutable because a lazily restored shape is only parsed on first access
+    mutable TopoShape _Shape;
     std::string _Ver;
+    // shape read by readDocFile() and not yet applied
+    std::unique_ptr<TopoShape> _RestoredShape;
+    // shape data kept by a lazy restore until it's accessed the first time
+    mutable std::shared_future<TopoShape> _PendingShape;
+    // the const getters may be called from several threads, the first one parses the shape
+    mutable std::mutex _PendingMutex;
+    mutable std::atomic<bool> _HasPendingShape {false};
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
 };
@@ -100,6 +100,7 @@
 
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
+#include <Base/Profiler.h>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
 #include <BRepFeat_MakeRevol.hxx>
 
@@ -1389,6 +1390,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const std::vector<TopoShape>& shapes,
                                               const char* op)
 {
+    ZoneScoped;
     setShape(shape);
     if (shape.IsNull()) {
         FC_THROWM(NullShapeException, "Null shape");
@@ -2087,6 +2089,7 @@ TopoShape& TopoShape::makeElementEvolve(const TopoShape& spine,
                                         double tol,
                                         const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Evolve;
     }
@@ -2165,6 +2168,7 @@ TopoShape& TopoShape::makeElementRuledSurface(const std::vector<TopoShape>& shap
                                               int orientation,
                                               const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::RuledSurface;
     }
@@ -2312,6 +2316,7 @@ TopoShape& TopoShape::makeElementCompound(const std::vector<TopoShape>& shapes,
                                           const char* op,
                                           SingleShapeCompoundCreationPolicy policy)
 {
+    ZoneScoped;
     if (policy == SingleShapeCompoundCreationPolicy::returnShape && shapes.size() == 1) {
         *this = shapes[0];
         return *this;
@@ -2376,6 +2381,7 @@ TopoShape& TopoShape::makeElementPipeShell(const std::vector<TopoShape>& shapes,
                                            double tolBound,
                                            double tolAngular)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::PipeShell;
     }
@@ -2448,6 +2454,7 @@ TopoShape& TopoShape::makeElementOffset(const TopoShape& shape,
                                         FillType fill,
                                         const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Offset;
     }
@@ -2583,6 +2590,7 @@ TopoShape& TopoShape::makeElementOffsetFace(const TopoShape& shape,
                                             JoinType innerJoinType,
                                             const char* op)
 {
+    ZoneScoped;
     if (std::abs(innerOffset) < Precision::Confusion()
         && std::abs(offset) < Precision::Confusion()) {
         *this = shape;
@@ -2654,6 +2662,7 @@ TopoShape& TopoShape::makeElementOffset2D(const TopoShape& shape,
                                           bool intersection,
                                           const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Offset2D;
     }
@@ -2978,6 +2987,7 @@ TopoShape& TopoShape::makeElementThickSolid(const TopoShape& shape,
                                             JoinType join,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Thicken;
     }
@@ -3043,6 +3053,7 @@ TopoShape& TopoShape::makeElementWires(const std::vector<TopoShape>& shapes,
                                        ConnectionPolicy policy,
                                        TopoShapeMap* output)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Wire;
     }
@@ -3297,6 +3308,7 @@ TopoShape& TopoShape::makeElementOrderedWires(const std::vector<TopoShape>& shap
                                               double tol,
                                               TopoShapeMap* output)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Wire;
     }
@@ -3355,6 +3367,7 @@ TopoShape& TopoShape::makeElementTransform(const TopoShape& shape,
                                            const char* op,
                                            CopyType copy)
 {
+    ZoneScoped;
     if (copy == CopyType::noCopy) {
         // OCCT checks the ScaleFactor against gp::Resolution() which is DBL_MIN!!!
         copy = trsf.ScaleFactor() * trsf.HVectorialPart().Determinant() < 0.
@@ -3400,6 +3413,7 @@ TopoShape& TopoShape::makeElementGTransform(const TopoShape& shape,
                                             const char* op,
                                             CopyType copy)
 {
+    ZoneScoped;
     if (shape.isNull()) {
         FC_THROWM(NullShapeException, "Null input shape");
     }
@@ -3641,6 +3655,7 @@ TopoShape& TopoShape::makeElementFilledFace(const std::vector<TopoShape>& _shape
                                             const BRepFillingParams& params,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::FilledFace;
     }
@@ -3837,6 +3852,7 @@ TopoShape& TopoShape::makeElementFilledFace(const std::vector<TopoShape>& _shape
 
 TopoShape& TopoShape::makeElementSolid(const TopoShape& shape, const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Solid;
     }
@@ -3888,6 +3904,7 @@ TopoShape& TopoShape::makeElementSolid(const TopoShape& shape, const char* op)
 
 TopoShape& TopoShape::makeElementMirror(const TopoShape& shape, const gp_Ax2& ax2, const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Mirror;
     }
@@ -3909,6 +3926,7 @@ TopoShape& TopoShape::makeElementSlice(const TopoShape& shape,
                                        double distance,
                                        const char* op)
 {
+    ZoneScoped;
     if (shape.isNull()) {
         FC_THROWM(NullShapeException, "Null shape");
     }
@@ -3925,6 +3943,7 @@ TopoShape& TopoShape::makeElementSlices(const TopoShape& shape,
                                         const std::vector<double>& distances,
                                         const char* op)
 {
+    ZoneScoped;
     std::vector<TopoShape> wires;
     TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
     int index = 0;
@@ -3982,6 +4001,7 @@ TopoShape& TopoShape::makeElementFillet(const TopoShape& shape,
                                         double radius2,
                                         const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Fillet;
     }
@@ -4014,6 +4034,7 @@ TopoShape& TopoShape::makeElementChamfer(const TopoShape& shape,
                                          const char* op,
                                          Flip flipDirection)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Chamfer;
     }
@@ -4063,6 +4084,7 @@ TopoShape& TopoShape::makeElementGeneralFuse(const std::vector<TopoShape>& _shap
                                              double tol,
                                              const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::GeneralFuse;
     }
@@ -4150,6 +4172,7 @@ TopoShape& TopoShape::makeElementShape(BRepFeat_MakePrism& mkShape,
                                        const TopoShape& upTo,
                                        const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Prism;
     }
@@ -4166,6 +4189,7 @@ TopoShape& TopoShape::makeElementLoft(const std::vector<TopoShape>& shapes,
                                       Standard_Integer maxDegree,
                                       const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Loft;
     }
@@ -4237,6 +4261,7 @@ TopoShape& TopoShape::makeElementLoft(const std::vector<TopoShape>& shapes,
 
 TopoShape& TopoShape::makeElementPrism(const TopoShape& base, const gp_Vec& vec, const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Extrude;
     }
@@ -4256,6 +4281,7 @@ TopoShape& TopoShape::makeElementPrismUntil(const TopoShape& _base,
                                             Standard_Boolean checkLimits,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Prism;
     }
@@ -4449,6 +4475,7 @@ TopoShape& TopoShape::makeElementRevolve(const TopoShape& _base,
                                          const char* face_maker,
                                          const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Revolve;
     }
@@ -4477,6 +4504,7 @@ TopoShape& TopoShape::makeElementRevolution(const TopoShape& _base,
                                             Standard_Boolean Modify,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Revolve;
     }
@@ -4519,6 +4547,7 @@ TopoShape& TopoShape::makeElementDraft(const TopoShape& shape,
                                        bool retry,
                                        const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Draft;
     }
@@ -4582,6 +4611,7 @@ TopoShape& TopoShape::makeElementFace(const std::vector<TopoShape>& shapes,
                                       const char* maker,
                                       const gp_Pln* plane)
 {
+    ZoneScoped;
     if (!maker || !maker[0]) {
         maker = "Part::FaceMakerBullseye";
     }
@@ -4656,6 +4686,7 @@ public:
 
 TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op, RefineFail no_fail)
 {
+    ZoneScoped;
     if (shape.isNull()) {
         if (no_fail == RefineFail::throwException) {
             FC_THROWM(NullShapeException, "Null shape");
@@ -4719,6 +4750,7 @@ TopoShape& TopoShape::makeElementBSplineFace(const std::vector<TopoShape>& input
                                              bool keepBezier,
                                              const char* op)
 {
+    ZoneScoped;
     std::vector<TopoShape> edges;
     for (auto& s : input) {
         auto e = s.getSubTopoShapes(TopAbs_EDGE);
@@ -5395,6 +5427,7 @@ const std::vector<TopoDS_Shape>& MapperHistory::generated(const TopoDS_Shape& s)
 // topo naming counterpart of TopoShape::makeShell()
 TopoShape& TopoShape::makeElementShell(bool silent, const char* op)
 {
+    ZoneScoped;
     if (silent) {
         if (isNull()) {
             return *this;
@@ -5487,6 +5520,7 @@ TopoShape& TopoShape::makeElementShellFromWires(const std::vector<TopoShape>& wi
                                                 bool silent,
                                                 const char* op)
 {
+    ZoneScoped;
     BRepFill_Generator maker;
     for (auto& w : wires) {
         if (w.shapeType(silent) == TopAbs_WIRE) {
@@ -5575,9 +5609,11 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
                                          const char* op,
                                          double tolerance)
 {
+    ZoneScoped;
     if (!maker) {
         FC_THROWM(Base::CADKernelError, "no maker");
     }
+    ZoneText(maker, strlen(maker));
 
     if (!op) {
         op = maker;
@@ -74,6 +74,7 @@
 #include <App/Document.h>
 #include <Base/Console.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 
@@ -928,6 +929,8 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
 
 void ViewProviderPartExt::updateVisual()
 {
+    ZoneScoped;
+
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
@@ -990,7 +993,10 @@ void ViewProviderPartExt::updateVisual()
         meshParams.InParallel = Standard_True;
         meshParams.AllowQualityDecrease = Standard_True;
 
-        BRepMesh_IncrementalMesh(cShape, meshParams);
+        {
+            ZoneScopedN("BRepMesh_IncrementalMesh");
+            BRepMesh_IncrementalMesh(cShape, meshParams);
+        }
 
         // We must reset the location here because the transformation data
         // are set in the placement property
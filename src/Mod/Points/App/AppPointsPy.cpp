@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <memory>
 #endif
 
@@ -73,6 +74,19 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    void readSubsampling(Reader& reader) const
+    {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points/Import");
+        long stride = hGrp->GetInt("Stride", 1);
+        double voxelSize = hGrp->GetFloat("VoxelSize", 0.0);
+
+        reader.setStride(static_cast<std::size_t>(std::max<long>(stride, 1)));
+        reader.setVoxelSize(voxelSize);
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -111,6 +125,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            readSubsampling(*reader);
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().newDocument();
@@ -233,6 +248,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            readSubsampling(*reader);
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().getDocument(DocName);
@@ -25,13 +25,17 @@
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
+#include <array>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
 
+#include <QFile>
+#include <QtConcurrentMap>
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>  // needed for compilation on some systems
-#include <boost/regex.hpp>
 #endif
 
 #include <Base/Console.h>
@@ -40,6 +44,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/Swap.h>
 
 #include "PointsAlgos.h"
 #include <E57Format.h>
@@ -47,6 +52,638 @@
 
 using namespace Points;
 
+namespace
+{
+// number of records of ASCII files that are read before the subsampling is applied
+constexpr std::size_t AsciiChunkSize = 65536;
+// number of records of binary files that are decoded at once
+constexpr std::size_t BinaryChunkSize = 1048576;
+// number of records decoded by one task
+constexpr std::size_t BlockSize = 16384;
+
+// Parses up to values.size() numbers of str and returns how many were found. The text after
+// the last number without leading whitespace is returned in rest.
+std::size_t parseNumbers(const char* str, std::vector<double>& values, const char*& rest)
+{
+    std::size_t count = 0;
+    while (count < values.size()) {
+        char* end = nullptr;
+        double value = std::strtod(str, &end);
+        if (end == str) {
+            break;
+        }
+        values[count++] = value;
+        str = end;
+    }
+
+    while (std::isspace(static_cast<unsigned char>(*str))) {
+        str++;
+    }
+    rest = str;
+    return count;
+}
+
+// Checks whether the line of an ASCII point file consists of exactly three numbers
+bool parseAsciiPoint(const std::string& line, std::vector<double>& values)
+{
+    const char* rest = nullptr;
+    return parseNumbers(line.c_str(), values, rest) == 3 && *rest == '\0';
+}
+
+bool isBlank(const std::string& line)
+{
+    return std::all_of(line.begin(), line.end(), [](char c) {
+        return std::isspace(static_cast<unsigned char>(c));
+    });
+}
+
+/**
+ * Decodes the records of a point cloud file directly into the arrays of a reader. Only the
+ * fields that are used are decoded and the points can be subsampled while reading, so that
+ * neither the file nor all of its fields must be held in memory.
+ */
+class PointDecoder
+{
+public:
+    enum class Type
+    {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64
+    };
+    enum class ColorType
+    {
+        None,
+        UChar,
+        Float,
+        PackedUInt,
+        PackedFloat
+    };
+    enum Field
+    {
+        X,
+        Y,
+        Z,
+        NormalX,
+        NormalY,
+        NormalZ,
+        Intensity,
+        Red,
+        Green,
+        Blue,
+        Alpha,
+        Packed,
+        NumFields
+    };
+    static constexpr std::size_t Missing = std::numeric_limits<std::size_t>::max();
+
+    PointDecoder(const std::vector<std::string>& fields, std::size_t stride, double voxelSize)
+        : numFields {fields.size()}
+        , stride {std::max<std::size_t>(stride, 1)}
+        , voxelSize {voxelSize}
+    {
+        auto find = [&fields](std::initializer_list<const char*> names) {
+            for (const char* name : names) {
+                auto it = std::ranges::find(fields, name);
+                if (it != fields.end()) {
+                    return static_cast<std::size_t>(std::distance(fields.begin(), it));
+                }
+            }
+            return Missing;
+        };
+
+        index[X] = find({"x"});
+        index[Y] = find({"y"});
+        index[Z] = find({"z"});
+        index[NormalX] = find({"normal_x", "nx"});
+        index[NormalY] = find({"normal_y", "ny"});
+        index[NormalZ] = find({"normal_z", "nz"});
+        index[Intensity] = find({"intensity"});
+        index[Red] = find({"red"});
+        index[Green] = find({"green"});
+        index[Blue] = find({"blue"});
+        index[Alpha] = find({"alpha"});
+        index[Packed] = find({"rgb", "rgba"});
+
+        hasNormals = has(NormalX) && has(NormalY) && has(NormalZ);
+        hasIntensity = has(Intensity);
+    }
+
+    std::size_t indexOf(Field field) const
+    {
+        return index[field];
+    }
+    bool hasPoints() const
+    {
+        return has(X) && has(Y) && has(Z);
+    }
+    void setColorType(ColorType type)
+    {
+        if (type == ColorType::UChar || type == ColorType::Float) {
+            if (has(Red) && has(Green) && has(Blue)) {
+                colorType = type;
+            }
+        }
+        else if (type == ColorType::PackedUInt || type == ColorType::PackedFloat) {
+            if (has(Packed)) {
+                colorType = type;
+            }
+        }
+    }
+
+    /// The fields of a record follow each other
+    void setRecordLayout(const std::vector<Type>& types, bool swap)
+    {
+        swapByteOrder = swap;
+        recordSize = 0;
+        layout.clear();
+        for (Type type : types) {
+            layout.push_back({type, recordSize, 0});
+            recordSize += sizeOf(type);
+        }
+        for (auto& it : layout) {
+            it.stride = recordSize;
+        }
+    }
+    /// All values of a field follow each other
+    void setColumnLayout(const std::vector<Type>& types, std::size_t numRecords)
+    {
+        swapByteOrder = false;
+        recordSize = 0;
+        layout.clear();
+        for (Type type : types) {
+            layout.push_back({type, recordSize * numRecords, sizeOf(type)});
+            recordSize += sizeOf(type);
+        }
+    }
+    std::size_t getRecordSize() const
+    {
+        return recordSize;
+    }
+
+    void reserve(std::size_t numRecords)
+    {
+        // with a voxel grid the final number of points is unknown
+        if (voxelSize <= 0.0 && hasPoints()) {
+            std::size_t count = countSelected(0, numRecords);
+            points.reserve(count);
+            if (hasNormals) {
+                normals.reserve(count);
+            }
+            if (hasIntensity) {
+                intensity.reserve(count);
+            }
+            if (colorType != ColorType::None) {
+                colors.reserve(count);
+            }
+        }
+    }
+
+    /// Appends count rows and returns the index of the first one.
+    std::size_t beginRows(std::size_t count)
+    {
+        std::size_t first = points.size();
+        resize(first + count);
+        return first;
+    }
+    /// Applies the voxel filter to the rows that have been decoded since beginRows().
+    void commit(std::size_t first, std::size_t count)
+    {
+        std::size_t last = first + count;
+        if (voxelSize > 0.0) {
+            last = first;
+            for (std::size_t row = first; row < first + count; row++) {
+                if (insertVoxel(points[row])) {
+                    move(row, last++);
+                }
+            }
+        }
+        resize(last);
+    }
+    /// Decodes a record, get returns the value of the field with the given index.
+    template<typename Getter>
+    void decode(std::size_t row, const Getter& get)
+    {
+        points[row].Set(static_cast<float>(get(index[X])),
+                        static_cast<float>(get(index[Y])),
+                        static_cast<float>(get(index[Z])));
+        if (hasNormals) {
+            normals[row].Set(static_cast<float>(get(index[NormalX])),
+                             static_cast<float>(get(index[NormalY])),
+                             static_cast<float>(get(index[NormalZ])));
+        }
+        if (hasIntensity) {
+            intensity[row] = static_cast<float>(get(index[Intensity]));
+        }
+
+        switch (colorType) {
+            case ColorType::UChar: {
+                float r = static_cast<float>(get(index[Red]));
+                float g = static_cast<float>(get(index[Green]));
+                float b = static_cast<float>(get(index[Blue]));
+                float a = has(Alpha) ? static_cast<float>(get(index[Alpha])) : 1.0F;
+                colors[row] = Base::Color(r / 255.0F, g / 255.0F, b / 255.0F, a / 255.0F);
+            } break;
+            case ColorType::Float: {
+                float r = static_cast<float>(get(index[Red]));
+                float g = static_cast<float>(get(index[Green]));
+                float b = static_cast<float>(get(index[Blue]));
+                float a = has(Alpha) ? static_cast<float>(get(index[Alpha])) : 1.0F;
+                colors[row] = Base::Color(r, g, b, a);
+            } break;
+            case ColorType::PackedUInt: {
+                auto packed = static_cast<uint32_t>(get(index[Packed]));
+                colors[row].setPackedARGB(packed);
+            } break;
+            case ColorType::PackedFloat: {
+                static_assert(sizeof(float) == sizeof(uint32_t),
+                              "float and uint32_t have different sizes");
+                auto f = static_cast<float>(get(index[Packed]));
+                uint32_t packed {};
+                std::memcpy(&packed, &f, sizeof(packed));
+                colors[row].setPackedARGB(packed);
+            } break;
+            default:
+                break;
+        }
+    }
+
+    /// Reads numRecords lines after skipping skipLines lines.
+    void readAscii(std::istream& inp, std::size_t numRecords, std::size_t skipLines)
+    {
+        if (!hasPoints()) {
+            return;
+        }
+
+        std::vector<double> values(numFields);
+        std::string line;
+        std::size_t record = 0;
+        bool eof = false;
+        while (record < numRecords && !eof) {
+            std::size_t count = std::min(AsciiChunkSize, countSelected(record, numRecords));
+            if (count == 0) {
+                break;
+            }
+
+            std::size_t first = beginRows(count);
+            std::size_t row = first;
+            while (row < first + count) {
+                if (!std::getline(inp, line)) {
+                    eof = true;
+                    break;
+                }
+                if (isBlank(line)) {
+                    continue;
+                }
+                if (skipLines > 0) {
+                    skipLines--;
+                    continue;
+                }
+                if (record++ % stride != 0) {
+                    continue;
+                }
+
+                const char* rest = nullptr;
+                std::size_t found = parseNumbers(line.c_str(), values, rest);
+                if (found < numFields && *rest != '\0') {
+                    throw Base::BadFormatError("Invalid number");
+                }
+                std::fill(values.begin() + static_cast<std::ptrdiff_t>(found), values.end(), 0.0);
+
+                decode(row++, [&values](std::size_t col) {
+                    return values[col];
+                });
+            }
+            commit(first, row - first);
+        }
+    }
+
+    /// Reads numRecords records that start offset bytes after the current position of inp.
+    /// The data is memory-mapped if possible, otherwise it is read in chunks.
+    void readBinary(const std::string& filename,
+                    std::istream& inp,
+                    std::size_t offset,
+                    std::size_t numRecords)
+    {
+        std::streamoff begin = std::streamoff(inp.tellg()) + static_cast<std::streamoff>(offset);
+        inp.seekg(0, std::ios::end);
+        std::streamoff end = inp.tellg();
+        std::size_t size = recordSize * numRecords;
+        if (begin + static_cast<std::streamoff>(size) > end) {
+            throw Base::BadFormatError("File expects too many elements");
+        }
+
+        if (!hasPoints() || numRecords == 0) {
+            return;
+        }
+
+        QFile file(QString::fromUtf8(filename.c_str()));
+        const uchar* mapped = nullptr;
+        if (file.open(QIODevice::ReadOnly)) {
+            mapped = file.map(static_cast<qint64>(begin), static_cast<qint64>(size));
+        }
+
+        std::vector<char> buffer;
+        if (!mapped) {
+            inp.clear();
+            inp.seekg(begin, std::ios::beg);
+        }
+
+        for (std::size_t first = 0; first < numRecords; first += BinaryChunkSize) {
+            std::size_t last = std::min(numRecords, first + BinaryChunkSize);
+            if (mapped) {
+                decodeBinary(reinterpret_cast<const char*>(mapped), 0, first, last);  // NOLINT
+            }
+            else {
+                buffer.resize((last - first) * recordSize);
+                if (!inp.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+                    throw Base::BadFormatError("Unexpected end of file");
+                }
+                decodeBinary(buffer.data(), first, first, last);
+            }
+        }
+    }
+
+    /// Decodes the data of numRecords records that are completely held in memory.
+    void readBinary(const std::vector<char>& data, std::size_t numRecords)
+    {
+        if (data.size() < recordSize * numRecords) {
+            throw Base::BadFormatError("File expects too many elements");
+        }
+
+        if (!hasPoints()) {
+            return;
+        }
+
+        for (std::size_t first = 0; first < numRecords; first += BinaryChunkSize) {
+            std::size_t last = std::min(numRecords, first + BinaryChunkSize);
+            decodeBinary(data.data(), 0, first, last);
+        }
+    }
+
+    /// Moves the decoded data to the arrays of a reader.
+    void swap(PointKernel& kernel,
+              std::vector<Base::Vector3f>& normal,
+              std::vector<float>& value,
+              std::vector<Base::Color>& color)
+    {
+        points.shrink_to_fit();
+        normals.shrink_to_fit();
+        intensity.shrink_to_fit();
+        colors.shrink_to_fit();
+        kernel.swap(points);
+        normal.swap(normals);
+        value.swap(intensity);
+        color.swap(colors);
+    }
+
+private:
+    struct FieldLayout
+    {
+        Type type;
+        std::size_t start;
+        std::size_t stride;
+    };
+    using Voxel = std::array<std::int64_t, 3>;
+    struct VoxelHash
+    {
+        std::size_t operator()(const Voxel& voxel) const
+        {
+            auto hash = static_cast<std::uint64_t>(voxel[0]) * 73856093U;
+            hash ^= static_cast<std::uint64_t>(voxel[1]) * 19349663U;
+            hash ^= static_cast<std::uint64_t>(voxel[2]) * 83492791U;
+            return static_cast<std::size_t>(hash);
+        }
+    };
+
+    bool has(Field field) const
+    {
+        return index[field] != Missing;
+    }
+    static std::size_t sizeOf(Type type)
+    {
+        switch (type) {
+            case Type::Int8:
+            case Type::UInt8:
+                return 1;
+            case Type::Int16:
+            case Type::UInt16:
+                return 2;
+            case Type::Int32:
+            case Type::UInt32:
+            case Type::Float32:
+                return 4;
+            case Type::Float64:
+                return 8;
+        }
+        return 0;
+    }
+    // number of records in [first, last) that are kept by the stride
+    std::size_t countSelected(std::size_t first, std::size_t last) const
+    {
+        return (last + stride - 1) / stride - (first + stride - 1) / stride;
+    }
+
+    template<typename T>
+    double read(const char* ptr) const
+    {
+        T value;
+        std::memcpy(&value, ptr, sizeof(T));
+        if (swapByteOrder) {
+            Base::SwapEndian(value);
+        }
+        return static_cast<double>(value);
+    }
+    double readValue(const char* ptr, Type type) const
+    {
+        switch (type) {
+            case Type::Int8:
+                return read<int8_t>(ptr);
+            case Type::UInt8:
+                return read<uint8_t>(ptr);
+            case Type::Int16:
+                return read<int16_t>(ptr);
+            case Type::UInt16:
+                return read<uint16_t>(ptr);
+            case Type::Int32:
+                return read<int32_t>(ptr);
+            case Type::UInt32:
+                return read<uint32_t>(ptr);
+            case Type::Float32:
+                return read<float>(ptr);
+            case Type::Float64:
+                return read<double>(ptr);
+        }
+        return 0.0;
+    }
+
+    // Decodes the selected records of [first, last), data holds the records from dataRecord on.
+    // The records are split into blocks that are decoded in parallel.
+    void decodeBinary(const char* data, std::size_t dataRecord, std::size_t first, std::size_t last)
+    {
+        std::size_t firstSelected = (first + stride - 1) / stride;
+        std::size_t count = countSelected(first, last);
+        std::size_t firstRow = beginRows(count);
+
+        using Block = std::pair<std::size_t, std::size_t>;
+        std::vector<Block> blocks;
+        for (std::size_t i = 0; i < count; i += BlockSize) {
+            blocks.emplace_back(i, std::min(count, i + BlockSize));
+        }
+
+        QtConcurrent::blockingMap(blocks, [&](Block& block) {
+            for (std::size_t i = block.first; i < block.second; i++) {
+                std::size_t record = (firstSelected + i) * stride - dataRecord;
+                decode(firstRow + i, [&](std::size_t col) {
+                    const FieldLayout& field = layout[col];
+                    return readValue(data + field.start + record * field.stride, field.type);
+                });
+            }
+        });
+
+        commit(firstRow, count);
+    }
+
+    bool insertVoxel(const Base::Vector3f& pnt)
+    {
+        // invalid points are dropped
+        if (!std::isfinite(pnt.x) || !std::isfinite(pnt.y) || !std::isfinite(pnt.z)) {
+            return false;
+        }
+
+        Voxel voxel {static_cast<std::int64_t>(std::floor(pnt.x / voxelSize)),
+                     static_cast<std::int64_t>(std::floor(pnt.y / voxelSize)),
+                     static_cast<std::int64_t>(std::floor(pnt.z / voxelSize))};
+        return voxels.insert(voxel).second;
+    }
+    void move(std::size_t from, std::size_t to)
+    {
+        if (from == to) {
+            return;
+        }
+        points[to] = points[from];
+        if (hasNormals) {
+            normals[to] = normals[from];
+        }
+        if (hasIntensity) {
+            intensity[to] = intensity[from];
+        }
+        if (colorType != ColorType::None) {
+            colors[to] = colors[from];
+        }
+    }
+    void resize(std::size_t size)
+    {
+        points.resize(size);
+        if (hasNormals) {
+            normals.resize(size);
+        }
+        if (hasIntensity) {
+            intensity.resize(size);
+        }
+        if (colorType != ColorType::None) {
+            colors.resize(size);
+        }
+    }
+
+private:
+    std::array<std::size_t, NumFields> index {};
+    std::size_t numFields;
+    std::size_t stride;
+    double voxelSize;
+    bool hasNormals {false};
+    bool hasIntensity {false};
+    ColorType colorType {ColorType::None};
+    bool swapByteOrder {false};
+    std::size_t recordSize {0};
+    std::vector<FieldLayout> layout;
+    std::unordered_set<Voxel, VoxelHash> voxels;
+
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> normals;
+    std::vector<float> intensity;
+    std::vector<Base::Color> colors;
+};
+
+PointDecoder::Type plyType(const std::string& type)
+{
+    if (type == "char" || type == "int8") {
+        return PointDecoder::Type::Int8;
+    }
+    if (type == "uchar" || type == "uint8") {
+        return PointDecoder::Type::UInt8;
+    }
+    if (type == "short" || type == "int16") {
+        return PointDecoder::Type::Int16;
+    }
+    if (type == "ushort" || type == "uint16") {
+        return PointDecoder::Type::UInt16;
+    }
+    if (type == "int" || type == "int32") {
+        return PointDecoder::Type::Int32;
+    }
+    if (type == "uint" || type == "uint32") {
+        return PointDecoder::Type::UInt32;
+    }
+    if (type == "float" || type == "float32") {
+        return PointDecoder::Type::Float32;
+    }
+    if (type == "double" || type == "float64") {
+        return PointDecoder::Type::Float64;
+    }
+    throw Base::BadFormatError("Unexpected type");
+}
+
+PointDecoder::Type pcdType(const std::string& type, int size)
+{
+    char t = type.empty() ? '\0' : type[0];
+    switch (size) {
+        case 1:
+            if (t == 'I') {
+                return PointDecoder::Type::Int8;
+            }
+            if (t == 'U') {
+                return PointDecoder::Type::UInt8;
+            }
+            break;
+        case 2:
+            if (t == 'I') {
+                return PointDecoder::Type::Int16;
+            }
+            if (t == 'U') {
+                return PointDecoder::Type::UInt16;
+            }
+            break;
+        case 4:
+            if (t == 'I') {
+                return PointDecoder::Type::Int32;
+            }
+            if (t == 'U') {
+                return PointDecoder::Type::UInt32;
+            }
+            if (t == 'F') {
+                return PointDecoder::Type::Float32;
+            }
+            break;
+        case 8:
+            if (t == 'F') {
+                return PointDecoder::Type::Float64;
+            }
+            break;
+        default:
+            break;
+    }
+    throw Base::BadFormatError("Unexpected type");
+}
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
 void PointsAlgos::Load(PointKernel& points, const char* FileName)
 {
     Base::FileInfo File(FileName);
@@ -66,46 +703,29 @@ void PointsAlgos::Load(PointKernel& points, const char* FileName)
 
 void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
 {
-    boost::regex rx("^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                    "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                    "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    // boost::regex rx("(\\b[0-9]+\\.([0-9]+\\b)?|\\.[0-9]+\\b)");
-    // boost::regex
-    // rx("^\\s*(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s*$");
-    boost::cmatch what;
-
-    Base::Vector3d pt;
-    int LineCnt = 0;
-    std::string line;
     Base::FileInfo fi(FileName);
+    Base::ifstream file(fi, std::ios::in);
 
-    Base::ifstream tmp_str(fi, std::ios::in);
-
-    // estimating size
-    while (std::getline(tmp_str, line)) {
-        LineCnt++;
-    }
-
-    // resize the PointKernel
-    points.resize(LineCnt);
+    // the progress is measured by the position in the file
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
 
-    Base::SequencerLauncher seq("Loading points...", LineCnt);
+    Base::SequencerLauncher seq("Loading points...", static_cast<size_t>(size));
 
-    // again to the beginning
-    Base::ifstream file(fi, std::ios::in);
-    LineCnt = 0;
+    std::vector<double> values(3);
+    std::string line;
+    std::size_t lines = 0;
+    points.clear();
 
     try {
         // read file
         while (std::getline(file, line)) {
-            if (boost::regex_match(line.c_str(), what, rx)) {
-                pt.x = std::atof(what[1].first);
-                pt.y = std::atof(what[4].first);
-                pt.z = std::atof(what[7].first);
-
-                points.setPoint(LineCnt, pt);
-                seq.next();
-                LineCnt++;
+            if (parseAsciiPoint(line, values)) {
+                points.push_back(Base::Vector3d(values[0], values[1], values[2]));
+            }
+            if (++lines % AsciiChunkSize == 0) {
+                seq.setProgress(static_cast<size_t>(file.tellg()));
             }
         }
     }
@@ -113,13 +733,6 @@ void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
         points.clear();
         throw Base::BadFormatError("Reading in points failed.");
     }
-
-    // now remove the last points from the kernel
-    // Note: first we allocate memory corresponding to the number of lines (points and comments)
-    //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size()) {
-        points.erase(LineCnt, points.size());
-    }
 }
 
 // ----------------------------------------------------------------------------
@@ -130,6 +743,7 @@ Reader::~Reader() = default;
 
 void Reader::clear()
 {
+    points.clear();
     intensity.clear();
     colors.clear();
     normals.clear();
@@ -190,15 +804,80 @@ int Reader::getHeight() const
     return height;
 }
 
+void Reader::setStride(std::size_t value)
+{
+    stride = std::max<std::size_t>(value, 1);
+}
+
+std::size_t Reader::getStride() const
+{
+    return stride;
+}
+
+void Reader::setVoxelSize(double value)
+{
+    voxelSize = std::max(value, 0.0);
+}
+
+double Reader::getVoxelSize() const
+{
+    return voxelSize;
+}
+
+bool Reader::isSubsampled() const
+{
+    return (stride > 1 || voxelSize > 0.0);
+}
+
 // ----------------------------------------------------------------------------
 
 AscReader::AscReader() = default;
 
 void AscReader::read(const std::string& filename)
 {
-    points.load(filename.c_str());
+    clear();
+
+    Base::FileInfo fi(filename);
+    if (!fi.isReadable()) {
+        throw Base::FileException("File to load not existing or not readable", fi);
+    }
+
+    Base::ifstream inp(fi, std::ios::in);
+    inp.seekg(0, std::ios::end);
+    std::streamoff size = inp.tellg();
+    inp.seekg(0, std::ios::beg);
+
+    Base::SequencerLauncher seq("Loading points...", static_cast<size_t>(size));
+
+    PointDecoder decoder({"x", "y", "z"}, stride, voxelSize);
+    std::vector<double> values(3);
+    std::string line;
+    std::size_t record = 0;
+    bool eof = false;
+    while (!eof) {
+        std::size_t first = decoder.beginRows(AsciiChunkSize);
+        std::size_t row = first;
+        while (row < first + AsciiChunkSize) {
+            if (!std::getline(inp, line)) {
+                eof = true;
+                break;
+            }
+            if (!parseAsciiPoint(line, values) || record++ % stride != 0) {
+                continue;
+            }
+            decoder.decode(row++, [&values](std::size_t col) {
+                return values[col];
+            });
+        }
+        decoder.commit(first, row - first);
+        if (!eof) {
+            seq.setProgress(static_cast<size_t>(inp.tellg()));
+        }
+    }
+
+    decoder.swap(points, normals, intensity, colors);
     this->height = 1;
-    this->width = points.size();
+    this->width = static_cast<int>(points.size());
 }
 
 // ----------------------------------------------------------------------------
@@ -246,90 +925,6 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
-{
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
-
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
-    }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
-    }
-    pos_type seekoff(std::streambuf::off_type off,
-                     std::ios_base::seekdir way,
-                     std::ios_base::openmode mode = std::ios::in | std::ios::out) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
-        }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
-        }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
-        }
-
-        if (p_pos > _end) {
-            return traits_type::eof();
-        }
-
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
-        }
-
-        _cur = p_pos + off;
-
-        return ((p_pos + off) - _beg);
-    }
-    pos_type seekpos(std::streambuf::pos_type pos,
-                     std::ios_base::openmode which = std::ios::in | std::ios::out) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
-    }
-
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
-
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
-
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
 unsigned int
@@ -557,163 +1152,39 @@ void PlyReader::read(const std::string& filename)
     std::vector<std::string> types;
     std::vector<int> sizes;
     std::size_t offset = 0;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
+    std::size_t numPoints = readHeader(inp, format, offset, fields, types, sizes);
 
-    this->width = numPoints;
+    this->width = static_cast<int>(numPoints);
     this->height = 1;
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
-    }
-
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
-
-    // x field
-    Eigen::Index x = max_size;
-    it = std::ranges::find(fields, "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
-    }
-
-    // y field
-    Eigen::Index y = max_size;
-    it = std::ranges::find(fields, "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
-    }
-
-    // z field
-    Eigen::Index z = max_size;
-    it = std::ranges::find(fields, "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
-    }
-
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::ranges::find(fields, "normal_x");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nx");
-    }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
-    }
-
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::ranges::find(fields, "normal_y");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "ny");
-    }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
-    }
-
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::ranges::find(fields, "normal_z");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nz");
-    }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
-    }
-
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::ranges::find(fields, "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
-    }
-
-    // rgb(a) field
-    Eigen::Index red = max_size;
-    Eigen::Index green = max_size;
-    Eigen::Index blue = max_size;
-    Eigen::Index alpha = max_size;
-    it = std::ranges::find(fields, "red");
-    if (it != fields.end()) {
-        red = std::distance(fields.begin(), it);
-    }
-
-    it = std::ranges::find(fields, "green");
-    if (it != fields.end()) {
-        green = std::distance(fields.begin(), it);
-    }
-
-    it = std::ranges::find(fields, "blue");
-    if (it != fields.end()) {
-        blue = std::distance(fields.begin(), it);
-    }
-
-    it = std::ranges::find(fields, "alpha");
-    if (it != fields.end()) {
-        alpha = std::distance(fields.begin(), it);
-    }
-
-    // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (red != max_size && green != max_size && blue != max_size);
-
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+    PointDecoder decoder(fields, stride, voxelSize);
+    std::size_t red = decoder.indexOf(PointDecoder::Red);
+    if (red != PointDecoder::Missing) {
+        if (types[red] == "uchar") {
+            decoder.setColorType(PointDecoder::ColorType::UChar);
         }
-    }
-
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+        else if (types[red] == "float") {
+            decoder.setColorType(PointDecoder::ColorType::Float);
         }
     }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
+    decoder.reserve(numPoints);
+    if (format == "ascii") {
+        decoder.readAscii(inp, numPoints, offset);
+    }
+    else if (format == "binary_little_endian" || format == "binary_big_endian") {
+        std::vector<PointDecoder::Type> layout;
+        layout.reserve(types.size());
+        for (const auto& it : types) {
+            layout.push_back(plyType(it));
         }
+        decoder.setRecordLayout(layout, format == "binary_big_endian");
+        decoder.readBinary(filename, inp, offset, numPoints);
     }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(static_cast<float>(r) / 255.0F,
-                                    static_cast<float>(g) / 255.0F,
-                                    static_cast<float>(b) / 255.0F,
-                                    static_cast<float>(a) / 255.0F);
-            }
-        }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(r, g, b, a);
-            }
-        }
+    decoder.swap(points, normals, intensity, colors);
+    if (isSubsampled()) {
+        this->width = static_cast<int>(points.size());
     }
 }
 
@@ -887,136 +1358,6 @@ std::size_t PlyReader::readHeader(std::istream& in,
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
-void PlyReader::readBinary(bool swapByteOrder,
-                           std::istream& inp,
-                           std::size_t offset,
-                           const std::vector<std::string>& types,
-                           const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
-{
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        const std::string& t = types[j];
-        switch (sizes[j]) {
-            case 1:
-                if (t == "char" || t == "int8") {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == "uchar" || t == "uint8") {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == "short" || t == "int16") {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == "ushort" || t == "uint16") {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == "int" || t == "int32") {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == "uint" || t == "uint32") {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == "float" || t == "float32") {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == "double" || t == "float64") {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
-    }
-
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
-        }
-    }
-}
-
 // ----------------------------------------------------------------------------
 
 PcdReader::PcdReader() = default;
@@ -1034,14 +1375,35 @@ void PcdReader::read(const std::string& filename)
     std::vector<std::string> fields;
     std::vector<std::string> types;
     std::vector<int> sizes;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
+    std::size_t numPoints = readHeader(inp, format, fields, types, sizes);
 
-    Eigen::MatrixXd data(numPoints, fields.size());
+    PointDecoder decoder(fields, stride, voxelSize);
+    std::size_t rgba = decoder.indexOf(PointDecoder::Packed);
+    if (rgba != PointDecoder::Missing) {
+        if (types[rgba] == "U") {
+            decoder.setColorType(PointDecoder::ColorType::PackedUInt);
+        }
+        else if (types[rgba] == "F") {
+            decoder.setColorType(PointDecoder::ColorType::PackedFloat);
+        }
+    }
+
+    auto layout = [&types, &sizes]() {
+        std::vector<PointDecoder::Type> layout;
+        layout.reserve(types.size());
+        for (std::size_t i = 0; i < types.size(); i++) {
+            layout.push_back(pcdType(types[i], sizes[i]));
+        }
+        return layout;
+    };
+
+    decoder.reserve(numPoints);
     if (format == "ascii") {
-        readAscii(inp, data);
+        decoder.readAscii(inp, numPoints, 0);
     }
     else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
+        decoder.setRecordLayout(layout(), false);
+        decoder.readBinary(filename, inp, 0, numPoints);
     }
     else if (format == "binary_compressed") {
         unsigned int c {};
@@ -1052,137 +1414,21 @@ void PcdReader::read(const std::string& filename)
         std::vector<char> compressed(c);
         inp.read(compressed.data(), c);
         std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
+        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) != u) {
             throw Base::BadFormatError("Failed to decompress binary data");
         }
-    }
-
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
-
-    // x field
-    Eigen::Index x = max_size;
-    it = std::ranges::find(fields, "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
-    }
-
-    // y field
-    Eigen::Index y = max_size;
-    it = std::ranges::find(fields, "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
-    }
-
-    // z field
-    Eigen::Index z = max_size;
-    it = std::ranges::find(fields, "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
-    }
-
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::ranges::find(fields, "normal_x");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nx");
-    }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
-    }
-
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::ranges::find(fields, "normal_y");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "ny");
-    }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
-    }
-
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::ranges::find(fields, "normal_z");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nz");
-    }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
-    }
-
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::ranges::find(fields, "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
-    }
-
-    // rgb(a) field
-    Eigen::Index rgba = max_size;
-    it = std::ranges::find(fields, "rgb");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "rgba");
-    }
-    if (it != fields.end()) {
-        rgba = std::distance(fields.begin(), it);
-    }
-
-    // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (rgba != max_size);
-
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
-    }
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
-    }
-
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
-        }
+        // the values are stored field by field
+        compressed.clear();
+        compressed.shrink_to_fit();
+        decoder.setColumnLayout(layout(), numPoints);
+        decoder.readBinary(uncompressed, numPoints);
     }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
-        }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t),
-                          "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
-                uint32_t packed {};
-                std::memcpy(&packed, &f, sizeof(packed));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
-        }
+    decoder.swap(points, normals, intensity, colors);
+    if (isSubsampled()) {
+        this->width = static_cast<int>(points.size());
+        this->height = 1;
     }
 }
 
@@ -1257,139 +1503,6 @@ std::size_t PcdReader::readHeader(std::istream& in,
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
-void PcdReader::readBinary(bool transpose,
-                           std::istream& inp,
-                           const std::vector<std::string>& types,
-                           const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
-{
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        char t = types[j][0];
-        switch (sizes[j]) {
-            case 1:
-                if (t == 'I') {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == 'I') {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == 'I') {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == 'F') {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == 'F') {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
-    }
-
-    Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-}
-
 // ----------------------------------------------------------------------------
 
 namespace
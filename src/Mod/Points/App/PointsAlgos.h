@@ -64,6 +64,16 @@ public:
     bool isStructured() const;
     int getWidth() const;
     int getHeight() const;
+    /** Subsampling while reading, used by the ASCII, PLY and PCD readers.
+     * With a stride of n only every n-th point of the file is kept, with a voxel size > 0
+     * only the first point inside each cubic cell of that edge length is kept.
+     * A subsampled point cloud is never structured.
+     */
+    void setStride(std::size_t);
+    std::size_t getStride() const;
+    void setVoxelSize(double);
+    double getVoxelSize() const;
+    bool isSubsampled() const;
 
     Reader(const Reader&) = delete;
     Reader(Reader&&) = delete;
@@ -78,6 +88,8 @@ protected:
     std::vector<Base::Vector3f> normals;
     int width {0};
     int height {1};
+    std::size_t stride {1};
+    double voxelSize {0.0};
     // NOLINTEND
 };
 
@@ -101,13 +113,6 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
-    void readBinary(bool swapByteOrder,
-                    std::istream&,
-                    std::size_t offset,
-                    const std::vector<std::string>& types,
-                    const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
 };
 
 class PointsExport PcdReader: public Reader
@@ -122,12 +127,6 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
-    void readBinary(bool transpose,
-                    std::istream&,
-                    const std::vector<std::string>& types,
-                    const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
 };
 
 class PointsExport E57Reader: public Reader
@@ -36,23 +36,26 @@
 
 // standard
 #include <cstdio>
+#include <cstring>
 
 // STL
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <memory>
 #include <set>
 #include <sstream>
+#include <unordered_set>
 #include <vector>
 
 // boost
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
-#include <boost/regex.hpp>
 
 // Qt
+#include <QFile>
 #include <QtConcurrentMap>
 
 #endif  //_PreComp_
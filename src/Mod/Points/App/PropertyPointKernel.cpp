@@ -133,6 +133,21 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+void PropertyPointKernel::readDocFile(Base::Reader& reader)
+{
+    PointKernel kernel;
+    kernel.RestoreDocFile(reader);
+    kernel.swap(_restoredPoints);
+}
+
+void PropertyPointKernel::finishRestoreDocFile()
+{
+    aboutToSetValue();
+    _cPoints->swap(_restoredPoints);
+    hasSetValue();
+    std::vector<PointKernel::value_type>().swap(_restoredPoints);
+}
+
 App::Property* PropertyPointKernel::Copy() const
 {
     PropertyPointKernel* prop = new PropertyPointKernel();
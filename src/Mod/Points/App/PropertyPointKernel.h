@@ -76,6 +76,12 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canRestoreDocFileConcurrently() const override
+    {
+        return true;
+    }
+    void readDocFile(Base::Reader& reader) override;
+    void finishRestoreDocFile() override;
     //@}
 
     /** @name Modification */
@@ -89,6 +95,8 @@ public:
 
 private:
     Base::Reference<PointKernel> _cPoints;
+    // points read by readDocFile() and not yet applied
+    std::vector<PointKernel::value_type> _restoredPoints;
 };
 
 }  // namespace Points
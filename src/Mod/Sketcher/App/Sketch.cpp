@@ -5002,6 +5002,7 @@ int Sketch::initMove(std::vector<GeoElementId> geoEltIds, bool fine)
 
     GCSsys.initSolution();
     isInitMove = true;
+    movedGeoEltIds = geoEltIds;
 
     return 0;
 }
@@ -5017,6 +5018,13 @@ void Sketch::resetInitMove()
     isInitMove = false;
 }
 
+void Sketch::updateMoveReference()
+{
+    if (isInitMove) {
+        GCSsys.updateReference();
+    }
+}
+
 int Sketch::initBSplinePieceMove(int geoId,
                                  PointPos pos,
                                  const Base::Vector3d& firstPoint,
@@ -5083,6 +5091,7 @@ int Sketch::initBSplinePieceMove(int geoId,
 
     GCSsys.initSolution();
     isInitMove = true;
+    movedGeoEltIds.clear();
     return 0;
 }
 
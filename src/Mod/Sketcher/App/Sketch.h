@@ -176,6 +176,18 @@ public:
      */
     void resetInitMove();
 
+    /** Returns whether a drag of exactly these elements is initialized
+     */
+    bool hasInitMove(const std::vector<GeoElementId>& geoEltIds) const
+    {
+        return isInitMove && geoEltIds == movedGeoEltIds;
+    }
+
+    /** Makes the last solution the starting point of the next solve of an initialized drag
+     * (warm start), instead of the sketch status at initMove()
+     */
+    void updateMoveReference();
+
     /** Limits a b-spline drag to the segment around `firstPoint`.
      */
     int limitBSplineMove(int geoId, PointPos pos, const Base::Vector3d& firstPoint);
@@ -611,6 +623,7 @@ private:
     std::vector<GCS::BSpline> BSplines;
 
     bool isInitMove;
+    std::vector<GeoElementId> movedGeoEltIds;  // elements of the drag set up by initMove
     bool isFine;
     Base::Vector3d initToPoint;
     double moveStep;
@@ -622,6 +635,14 @@ public:
     {
         GCSsys.dogLegGaussStep = mode;
     }
+    inline void setJacobianStorage(GCS::JacobianStorage storage)
+    {
+        GCSsys.jacobianStorage = storage;
+    }
+    inline void setSolveThreads(int threads)
+    {
+        GCSsys.solveThreads = threads;
+    }
     inline void setDebugMode(GCS::DebugMode mode)
     {
         debugMode = mode;
@@ -197,6 +197,11 @@ SketchObject::SketchObject() : geoLastId(0)
 
     noRecomputes = false;
 
+    // independent parts of the sketch may be solved concurrently
+    ParameterGrp::handle hGrpSolver = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Sketcher/SolverAdvanced");
+    solvedSketch.setSolveThreads(static_cast<int>(hGrpSolver->GetInt("SolveThreads", 1)));
+
     //NOLINTBEGIN
     ExpressionEngine.setValidator(
         std::bind(&Sketcher::SketchObject::validateExpression, this, sp::_1, sp::_2));
@@ -1382,6 +1387,13 @@ int SketchObject::moveGeometries(std::vector<GeoElementId> geoEltIds, const Base
     if (lastHasConflict)// conflicting constraints
         return -1;
 
+    // Consecutive absolute moves of the same elements, e.g. a scripted drag, keep the move set
+    // up by the previous call (temporary constraints and solver subsystems) and start from its
+    // solution. Any change of the sketch in between resets the solver and hence the move.
+    if (relative || !solvedSketch.hasInitMove(geoEltIds)) {
+        solvedSketch.resetInitMove();
+    }
+
     // move the point and solve
     lastSolverStatus = solvedSketch.moveGeometries(geoEltIds, toPoint, relative);
 
@@ -1399,7 +1411,12 @@ int SketchObject::moveGeometries(std::vector<GeoElementId> geoEltIds, const Base
         }
     }
 
-    solvedSketch.resetInitMove();// reset solver point moving mechanism
+    if (lastSolverStatus == 0 && !relative) {
+        solvedSketch.updateMoveReference();
+    }
+    else {
+        solvedSketch.resetInitMove();// reset solver point moving mechanism
+    }
 
     return lastSolverStatus;
 }
@@ -47,10 +47,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <iostream>
 #include <limits>
 #include <numbers>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -96,6 +98,7 @@
 #endif
 
 #include <Base/Console.h>
+#include <Base/Profiler.h>
 #include <FCConfig.h>
 
 #include <boost/graph/connected_components.hpp>
@@ -479,6 +482,8 @@ System::System()
     , convergenceRedundant(1e-10)
     , qrAlgorithm(EigenSparseQR)
     , dogLegGaussStep(FullPivLU)
+    , jacobianStorage(DenseJacobian)
+    , solveThreads(1)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
     , LM_eps(1E-10)
@@ -1814,6 +1819,7 @@ void System::declareDrivenParams(VEC_pD& params)
 
 void System::initSolution(Algorithm alg)
 {
+    ZoneScoped;
     // - Stores the current parameters values in the vector "reference"
     // - identifies any decoupled subsystems and partitions the original
     //   system into corresponding components
@@ -1951,6 +1957,13 @@ void System::initSolution(Algorithm alg)
     isInit = true;
 }
 
+void System::updateReference()
+{
+    if (isInit) {
+        setReference();
+    }
+}
+
 void System::setReference()
 {
     reference.clear();
@@ -1980,30 +1993,66 @@ int System::solve(VEC_pD& params, bool isFine, Algorithm alg, bool isRedundantso
 
 int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
 {
+    ZoneScoped;
     if (!isInit) {
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    std::vector<int> components;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            components.push_back(cid);
         }
+    }
+    if (!components.empty()) {
+        resetToReference();
+    }
+
+    auto solveComponent = [&](int cid) {
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            return solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            return solve(subSystems[cid], isFine, alg, isRedundantsolving);
+        }
+        else {
+            return solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+        }
+    };
+
+    // The components share neither parameters nor constraints, so they can be solved
+    // concurrently. The results are merged in component order to stay deterministic.
+    std::vector<int> results(components.size(), Success);
+    int threads = solveThreads > 0 ? solveThreads
+                                   : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::min(threads, static_cast<int>(components.size()));
+    if (threads > 1) {
+        std::atomic<size_t> next {0};
+        auto worker = [&]() {
+            for (size_t i = next++; i < components.size(); i = next++) {
+                results[i] = solveComponent(components[i]);
+            }
+        };
+        std::vector<std::future<void>> workers;
+        for (int i = 0; i < threads; ++i) {
+            workers.push_back(std::async(std::launch::async, worker));
+        }
+        for (auto& w : workers) {
+            w.get();
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    }
+    else {
+        for (size_t i = 0; i < components.size(); ++i) {
+            results[i] = solveComponent(components[i]);
         }
     }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int result : results) {
+        res = std::max(res, result);
+    }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
              constr != redundant.end();
@@ -2039,6 +2088,7 @@ int System::solve(SubSystem* subsys, bool isFine, Algorithm alg, bool isRedundan
 
 int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolving)
 {
+    ZoneScoped;
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2165,8 +2215,98 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+
+// Overloads used by the dense and the sparse variants of solve_LM and solve_DL
+
+void setDiagonal(Eigen::MatrixXd& A, const Eigen::VectorXd& diag)
+{
+    A.diagonal() = diag;
+}
+
+Eigen::VectorXd solveNormalEquations(const Eigen::MatrixXd& A, const Eigen::VectorXd& g)
+{
+    return A.fullPivLu().solve(g);
+}
+
+Eigen::VectorXd
+gaussNewtonStep(const Eigen::MatrixXd& Jx, const Eigen::VectorXd& fx, DogLegGaussStep mode)
+{
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (mode) {
+        case FullPivLU:
+            return Jx.fullPivLu().solve(-fx);
+        case LeastNormFullPivLU:
+            return Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+        case LeastNormLdlt:
+            return Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+    }
+    return Eigen::VectorXd::Zero(Jx.cols());
+}
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+void setDiagonal(Eigen::SparseMatrix<double>& A, const Eigen::VectorXd& diag)
+{
+    for (int i = 0; i < diag.size(); ++i) {
+        A.coeffRef(i, i) = diag[i];
+    }
+}
+
+Eigen::VectorXd solveNormalEquations(const Eigen::SparseMatrix<double>& A,
+                                     const Eigen::VectorXd& g)
+{
+    // A is augmented by mu > 0, hence positive definite
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(A);
+    if (ldlt.info() != Eigen::Success) {
+        // rejected by the residual check of the caller
+        return Eigen::VectorXd::Zero(g.size());
+    }
+    return ldlt.solve(g);
+}
+
+Eigen::VectorXd gaussNewtonStep(const Eigen::SparseMatrix<double>& Jx,
+                                const Eigen::VectorXd& fx,
+                                DogLegGaussStep mode)
+{
+    if (mode != FullPivLU) {
+        // least norm step, Jx * Jx^T is only semi-definite for redundant constraints
+        Eigen::SparseMatrix<double> JJt = Jx * Jx.transpose();
+        Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(JJt);
+        if (ldlt.info() == Eigen::Success) {
+            Eigen::VectorXd y = ldlt.solve(-fx);
+            if (y.allFinite()) {
+                return Jx.transpose() * y;
+            }
+        }
+    }
+
+    // basic solution of the rank revealing QR, the sparse counterpart of FullPivLU
+    Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr(Jx);
+    if (qr.info() != Eigen::Success) {
+        return Eigen::VectorXd::Zero(Jx.cols());
+    }
+    return qr.solve(-fx);
+}
+#endif
+
+}  // namespace
+
+int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
+{
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (jacobianStorage == SparseJacobian) {
+        return solve_LM<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_LM<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianMatrix>
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
+    ZoneScoped;
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2180,8 +2320,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    JacobianMatrix J(csize, xsize);  // Jacobi of the subsystem
+    JacobianMatrix A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2258,12 +2398,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         int k = 0;
         while (k < 50) {
             // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
-            }
+            setDiagonal(A, (diag_A.array() + mu).matrix());
 
             // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            h = solveNormalEquations(A, g);
             double rel_error = (A * h - g).norm() / g.norm();
 
             // check if solving works
@@ -2314,9 +2452,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
-            }
+            setDiagonal(A, diag_A);  // restore diagonal J^T J entries
 
             k++;
         }
@@ -2341,12 +2477,25 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
     }
 
     subsys->revertParams();
+    TracyPlot("GCS LevenbergMarquardt iterations", static_cast<int64_t>(iter));
 
     return (stop == 1) ? Success : Failed;
 }
 
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (jacobianStorage == SparseJacobian) {
+        return solve_DL<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_DL<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianMatrix>
+int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+{
+    ZoneScoped;
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2381,6 +2530,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                        ? "FullPivLU"
                        : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
                                                                 : "LeastNormLdlt"))
+               << ", jacobian: " << (jacobianStorage == SparseJacobian ? "sparse" : "dense")
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
                << "\n";
 
@@ -2390,7 +2540,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    JacobianMatrix Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2442,19 +2592,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        h_gn = gaussNewtonStep(Jx, fx, dogLegGaussStep);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -2550,6 +2688,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
     }
 
     subsys->revertParams();
+    TracyPlot("GCS DogLeg iterations", static_cast<int64_t>(iter));
 
     if (debugMode == IterationLevel) {
         std::stringstream stream;
@@ -4618,6 +4757,7 @@ void System::extractSubsystem(SubSystem* subsys, bool isRedundantsolving)
 // treating the first of them as of higher priority than the second
 int System::solve(SubSystem* subsysA, SubSystem* subsysB, bool /*isFine*/, bool isRedundantsolving)
 {
+    ZoneScoped;
     int xsizeA = subsysA->pSize();
     int xsizeB = subsysB->pSize();
     int csizeA = subsysA->cSize();
@@ -4856,6 +4996,7 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
 
 int System::diagnose(Algorithm alg)
 {
+    ZoneScoped;
     // Analyses the constrainess grad of the system and provides feedback
     // The vector "conflictingTags" will hold a group of conflicting constraints
 
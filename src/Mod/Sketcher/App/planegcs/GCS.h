@@ -78,6 +78,13 @@ enum QRAlgorithm
     EigenSparseQR = 1
 };
 
+// Storage of the Jacobian in the LevenbergMarquardt and DogLeg solvers
+enum JacobianStorage
+{
+    DenseJacobian = 0,
+    SparseJacobian = 1
+};
+
 enum DebugMode
 {
     NoDebug = 0,
@@ -146,6 +153,11 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // JacobianMatrix is either Eigen::MatrixXd or Eigen::SparseMatrix<double>
+    template<typename JacobianMatrix>
+    int solve_LM(SubSystem* subsys, bool isRedundantsolving);
+    template<typename JacobianMatrix>
+    int solve_DL(SubSystem* subsys, bool isRedundantsolving);
 
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
@@ -224,6 +236,9 @@ public:
     double convergenceRedundant;
     QRAlgorithm qrAlgorithm;
     DogLegGaussStep dogLegGaussStep;
+    JacobianStorage jacobianStorage;
+    // number of threads solving independent subsystems, 0 means one per hardware thread
+    int solveThreads;
     double qrpivotThreshold;
     DebugMode debugMode;
     double LM_eps;
@@ -542,6 +557,10 @@ public:
     void declareUnknowns(VEC_pD& params);
     void declareDrivenParams(VEC_pD& params);
     void initSolution(Algorithm alg = DogLeg);
+    // Makes the current parameter values the starting point of the following solve() calls.
+    // Subsequent solves of an unchanged system, e.g. the steps of a drag operation, can so
+    // start from the last solution without setting up the subsystems again in initSolution().
+    void updateReference();
 
     int solve(bool isFine = true, Algorithm alg = DogLeg, bool isRedundantsolving = false);
     int solve(VEC_pD& params,
@@ -276,6 +276,32 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    if (jacobiPattern.rows() != csize || jacobiPattern.cols() != psize) {
+        // c2p refers to the entries of pvals, so the column is the offset in pvals
+        std::vector<Eigen::Triplet<double>> pattern;
+        for (int i = 0; i < csize; i++) {
+            const VEC_pD& constr_params = c2p[clist[i]];
+            for (VEC_pD::const_iterator p = constr_params.begin(); p != constr_params.end(); ++p) {
+                pattern.emplace_back(i, static_cast<int>(*p - pvals.data()), 0.);
+            }
+        }
+        jacobiPattern.resize(csize, psize);
+        jacobiPattern.setFromTriplets(pattern.begin(), pattern.end());
+    }
+    if (jacobi.rows() != csize || jacobi.cols() != psize
+        || jacobi.nonZeros() != jacobiPattern.nonZeros()) {
+        jacobi = jacobiPattern;
+    }
+
+    for (int j = 0; j < psize; j++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(jacobi, j); it; ++it) {
+            it.valueRef() = clist[it.row()]->grad(&pvals[j]);
+        }
+    }
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
@@ -144,6 +144,7 @@ App::DocumentObjectExecReturn* DrawBrokenView::execute()
         return App::DocumentObject::StdReturn;
     }
 
+    finishDeferredHlr();
     if (waitingForResult()) {
         // don't start something new until the in-progress events complete
         return DrawView::execute();     // NOLINT
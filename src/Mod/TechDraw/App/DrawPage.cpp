@@ -31,6 +31,7 @@
 #include <App/Document.h>
 #include <App/Link.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
 #include <Base/Parameter.h>
 
 #include "DrawPage.h"
@@ -139,8 +140,26 @@ void DrawPage::onChanged(const App::Property* prop)
     App::DocumentObject::onChanged(prop);
 }
 
-//Page is just a container. It doesn't "do" anything.
-App::DocumentObjectExecReturn* DrawPage::execute(void) { return App::DocumentObject::execute(); }
+//Page is just a container. It only collects the results of the views that have left their HLR
+//running in parallel in console mode, see DrawViewPart::canDeferHlr.
+App::DocumentObjectExecReturn* DrawPage::execute(void)
+{
+    if (!DrawUtil::isGuiUp()) {
+        for (auto* obj : Views.getValues()) {
+            auto* view = freecad_cast<DrawViewPart*>(obj);
+            //finishing may start another projection, e.g. to fit an automatic scale
+            while (view && view->waitingForHlr()) {
+                try {
+                    view->finishDeferredHlr();
+                }
+                catch (const Base::Exception&) {
+                    //already reported, the view keeps its previous geometry
+                }
+            }
+        }
+    }
+    return App::DocumentObject::execute();
+}
 
 // this is now irrelevant, b/c DP::execute doesn't do anything.
 short DrawPage::mustExecute() const
@@ -171,6 +171,23 @@ App::DocumentObjectExecReturn* DrawProjGroup::execute()
 {
     //    Base::Console().Message("DPG::execute() - %s - waitingForChildren: %d\n",
     //                            getNameInDocument(), waitingForChildren());
+    //in console mode the items leave their HLR running in parallel until now.  The items
+    //report ready while they finish, but the rest of execute takes care of that.
+    m_finishingItems = true;
+    try {
+        for (auto v : Views.getValues()) {
+            auto* dpgi = dynamic_cast<DrawProjGroupItem*>(v);
+            if (dpgi) {
+                dpgi->finishDeferredHlr();
+            }
+        }
+    }
+    catch (...) {
+        m_finishingItems = false;
+        throw;
+    }
+    m_finishingItems = false;
+
     if (!keepUpdated())
         return App::DocumentObject::StdReturn;
 
@@ -228,7 +245,7 @@ short DrawProjGroup::mustExecute() const
 void DrawProjGroup::reportReady()
 {
     //    Base::Console().Message("DPG::reportReady - waitingForChildren: %d\n", waitingForChildren());
-    if (waitingForChildren()) {
+    if (waitingForChildren() || m_finishingItems) {
         //not ready yet
         return;
     }
@@ -198,6 +198,10 @@ protected:
                            std::array<Base::BoundBox3d, MAXPROJECTIONCOUNT> bboxes);
     double getMaxColWidth(std::array<int, 3> list,
                           std::array<Base::BoundBox3d, MAXPROJECTIONCOUNT> bboxes);
+
+private:
+    //! true while execute collects the deferred HLR results of the items
+    bool m_finishingItems {false};
 };
 
 } //namespace TechDraw
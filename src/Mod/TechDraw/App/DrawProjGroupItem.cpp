@@ -27,6 +27,7 @@
 # include <gp_Ax2.hxx>
 #endif
 
+#include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <Base/Console.h>
 
@@ -113,6 +114,7 @@ App::DocumentObjectExecReturn *DrawProjGroupItem::execute()
         return DrawView::execute();
     }
 
+    finishDeferredHlr();
     if (waitingForHlr()) {
         return DrawView::execute();
     }
@@ -148,6 +150,21 @@ void DrawProjGroupItem::postHlrTasks()
     }
 }
 
+//! the group executes after all its items, so in console mode it can collect the HLR results of
+//! its items and the items of a group are projected in parallel. This only holds while the
+//! document recomputes and the group is queued in that recompute, otherwise nobody would collect
+//! the results before they are needed.
+bool DrawProjGroupItem::canDeferHlr() const
+{
+    DrawProjGroup* pGroup = getPGroup();
+    App::Document* doc = getDocument();
+    if (!pGroup || !doc) {
+        return false;
+    }
+    return doc->testStatus(App::Document::Recomputing)
+        && pGroup->testStatus(App::ObjectStatus::PendingRecompute);
+}
+
 void DrawProjGroupItem::autoPosition()
 {
     DrawProjGroup* pGroup = getPGroup();
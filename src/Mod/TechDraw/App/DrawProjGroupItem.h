@@ -53,6 +53,7 @@ public:
     void unsetupObject() override;
 
     void postHlrTasks(void) override;
+    bool canDeferHlr() const override;
 
     DrawProjGroup* getPGroup() const;
     double getRotateAngle();
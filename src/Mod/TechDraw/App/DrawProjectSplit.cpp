@@ -25,8 +25,12 @@
 #ifndef _PreComp_
 # include <algorithm>
 # include <limits>
+# include <numeric>
 # include <sstream>
+#include <QtConcurrentMap>
+#include <Bnd_BoundSortBox.hxx>
 #include <Bnd_Box.hxx>
+#include <Bnd_HArray1OfBox.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
@@ -125,12 +129,19 @@ TechDraw::GeometryObjectPtr DrawProjectSplit::buildGeometryObject(TopoDS_Shape s
 //note param gets modified here
 bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds)
 {
-    param = -2;
-
-    //eliminate obvious cases
     Bnd_Box sBox;
     BRepBndLib::AddOptimal(e, sBox);
     sBox.SetGap(0.1);
+    return isOnEdge(e, sBox, v, param, allowEnds);
+}
+
+//as above, but with the bounding box of e already computed by the caller
+bool DrawProjectSplit::isOnEdge(const TopoDS_Edge& e, const Bnd_Box& sBox, const TopoDS_Vertex& v,
+                                double& param, bool allowEnds)
+{
+    param = -2;
+
+    //eliminate obvious cases
     if (!sBox.IsVoid()) {
         gp_Pnt pt = BRep_Tool::Pnt(v);
         if (sBox.IsOut(pt)) {
@@ -164,6 +175,77 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
 }
 
 
+//HLR algo does not provide all edge intersections for edge endpoints, so long edges touched by a
+//vertex of another edge have to be split.  The edge boxes are computed once and indexed, so only
+//the edges whose box contains an end point are checked.  The checks run in parallel, but the
+//splits are returned in the same order as a sequential loop over all pairs of edges would give.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    int edgeCount = edges.size();
+    if (edgeCount == 0) {
+        return {};
+    }
+
+    std::vector<Bnd_Box> boxes(edgeCount);
+    Handle(Bnd_HArray1OfBox) indexBoxes = new Bnd_HArray1OfBox(1, edgeCount);
+    for (int iEdge = 0; iEdge < edgeCount; iEdge++) {
+        BRepBndLib::AddOptimal(edges.at(iEdge), boxes.at(iEdge));
+        boxes.at(iEdge).SetGap(0.1);
+        indexBoxes->SetValue(iEdge + 1, boxes.at(iEdge));
+    }
+
+    //Bnd_BoundSortBox is not thread safe, so collect the candidates before going parallel
+    Bnd_BoundSortBox index;
+    index.Initialize(indexBoxes);
+    std::vector<std::vector<int>> candidates(edgeCount);
+    for (int iOuter = 0; iOuter < edgeCount; iOuter++) {
+        if (boxes.at(iOuter).IsVoid()) {
+            continue;
+        }
+        std::vector<int>& near = candidates.at(iOuter);
+        for (const auto& vert : {TopExp::FirstVertex(edges.at(iOuter)),
+                                 TopExp::LastVertex(edges.at(iOuter))}) {
+            for (int iBox : index.Compare(BRep_Tool::Pnt(vert))) {
+                near.push_back(iBox - 1);
+            }
+        }
+        std::sort(near.begin(), near.end());
+        near.erase(std::unique(near.begin(), near.end()), near.end());
+    }
+
+    std::vector<std::vector<splitPoint>> outerSplits(edgeCount);
+    std::vector<int> outerIndexes(edgeCount);
+    std::iota(outerIndexes.begin(), outerIndexes.end(), 0);
+    QtConcurrent::blockingMap(outerIndexes, [&](int iOuter) {
+        const Bnd_Box& sOuter = boxes.at(iOuter);
+        TopoDS_Vertex v1 = TopExp::FirstVertex(edges.at(iOuter));
+        TopoDS_Vertex v2 = TopExp::LastVertex(edges.at(iOuter));
+        for (int iInner : candidates.at(iOuter)) {
+            const Bnd_Box& sInner = boxes.at(iInner);
+            if (iInner == iOuter || sInner.IsVoid() || sOuter.IsOut(sInner)) {
+                continue;
+            }
+            for (const auto& vert : {v1, v2}) {
+                double param = -1;
+                if (isOnEdge(edges.at(iInner), sInner, vert, param, false)) {
+                    gp_Pnt pnt = BRep_Tool::Pnt(vert);
+                    splitPoint s;
+                    s.i = iInner;
+                    s.v = Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z());
+                    s.param = param;
+                    outerSplits.at(iOuter).push_back(s);
+                }
+            }
+        }
+    });
+
+    std::vector<splitPoint> splits;
+    for (auto& outer : outerSplits) {
+        splits.insert(splits.end(), outer.begin(), outer.end());
+    }
+    return splits;
+}
+
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
     std::vector<TopoDS_Edge> result;
@@ -594,13 +676,37 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
     int edgeCount = inEdges.size();
+    if (edgeCount == 0) {
+        return outEdges;
+    }
+
+    //edges with disjoint boxes are never subsets of each other, so only the pairs found in an
+    //index of the boxes need the boolean check.  Same boxes as in boxesIntersect.
+    std::vector<Bnd_Box> boxes(edgeCount);
+    Handle(Bnd_HArray1OfBox) indexBoxes = new Bnd_HArray1OfBox(1, edgeCount);
+    for (int iEdge = 0; iEdge < edgeCount; iEdge++) {
+        BRepBndLib::Add(inEdges.at(iEdge), boxes.at(iEdge));
+        boxes.at(iEdge).SetGap(0.1);
+        indexBoxes->SetValue(iEdge + 1, boxes.at(iEdge));
+    }
+    Bnd_BoundSortBox index;
+    index.Initialize(indexBoxes);
+
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
+        std::vector<int> near;
+        if (!boxes.at(ie0).IsVoid()) {
+            for (int iBox : index.Compare(boxes.at(ie0))) {
+                if (iBox - 1 > ie0) {
+                    near.push_back(iBox - 1);
+                }
+            }
+        }
+        std::sort(near.begin(), near.end());
+        for (int ie1 : near) {
             if (skipThisEdge.at(ie1)) {
                 continue;
             }
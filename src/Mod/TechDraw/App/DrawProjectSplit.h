@@ -36,6 +36,7 @@
 
 class gp_Pnt;
 class gp_Ax2;
+class Bnd_Box;
 
 namespace TechDraw
 {
@@ -102,6 +103,9 @@ public:
     static TechDraw::GeometryObjectPtr  buildGeometryObject(TopoDS_Shape shape, const gp_Ax2& viewAxis);
 
     static bool isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds = false);
+    static bool isOnEdge(const TopoDS_Edge& e, const Bnd_Box& edgeBox, const TopoDS_Vertex& v,
+                         double& param, bool allowEnds = false);
+    static std::vector<splitPoint> findSplitPoints(const std::vector<TopoDS_Edge>& edges);
     static std::vector<TopoDS_Edge> splitEdges(std::vector<TopoDS_Edge> orig, std::vector<splitPoint> splits);
     static std::vector<TopoDS_Edge> split1Edge(TopoDS_Edge e, std::vector<splitPoint> splitPoints);
 
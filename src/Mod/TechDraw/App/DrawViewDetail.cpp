@@ -143,6 +143,8 @@ App::DocumentObjectExecReturn* DrawViewDetail::execute()
         return DrawView::execute();
     }
 
+    finishDeferredHlr();
+
     App::DocumentObject* baseObj = BaseView.getValue();
     if (!baseObj) {
         return DrawView::execute();
@@ -192,6 +194,7 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
         makeDetailShape(shape, dvp, dvs);
         onMakeDetailFinished();
         waitingForDetail(false);
+        return;
     }
 
     //note that &m_detailWatcher in the third parameter is not strictly required, but using the
@@ -410,7 +413,7 @@ void DrawViewDetail::onMakeDetailFinished(void)
     QObject::disconnect(connectDetailWatcher);
 
     m_tempGeometryObject = buildGeometryObject(m_scaledShape, m_viewAxis);
-    if (!DU::isGuiUp()) {
+    if (!DU::isGuiUp() && !waitingForHlr()) {
         onHlrFinished();
     }
 }
@@ -53,6 +53,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
@@ -89,6 +90,8 @@
 #include "EdgeWalker.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
+#include "HLRScheduler.h"
 #include "ShapeExtractor.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
@@ -177,10 +180,8 @@ TopoDS_Shape DrawViewPart::getSourceShape(bool fuse) const
     if (links.empty()) {
         return TopoDS_Shape();
     }
-    if (fuse) {
-        return ShapeExtractor::getShapesFused(links);
-    }
-    return ShapeExtractor::getShapes(links);
+    //views of the same objects share the source shape during a recompute
+    return HLRScheduler::instance().getSourceShape(links, fuse);
 }
 
 //! deliver a shape appropriate for making a detail view based on this view
@@ -232,6 +233,7 @@ App::DocumentObjectExecReturn* DrawViewPart::execute()
         return DrawView::execute();
     }
 
+    finishDeferredHlr();
     if (waitingForHlr()) {
         return DrawView::execute();
     }
@@ -294,12 +296,68 @@ void DrawViewPart::partExec(TopoDS_Shape& shape)
     //we need to keep using the old geometryObject until the new one is fully populated
     m_tempGeometryObject = makeGeometryForShape(shape);
     if (CoarseView.getValue() ||
-        !DU::isGuiUp()) {
+        (!DU::isGuiUp() && !waitingForHlr())) {
         onHlrFinished();//poly algo and console mode do not run in separate thread, so we need to invoke
                         //the post hlr processing manually
     }
 }
 
+//! in console mode a view on a page starts its HLR and leaves the result to the page, so that the
+//! views of a page are projected in parallel. This only holds while the document recomputes and
+//! the page is queued in that recompute, see DrawPage::execute.
+bool DrawViewPart::canDeferHlr() const
+{
+    App::Document* doc = getDocument();
+    if (!doc || !doc->testStatus(App::Document::Recomputing)) {
+        return false;
+    }
+    for (auto* parent : getInList()) {
+        auto* page = freecad_cast<DrawPage*>(parent);
+        if (page && page->testStatus(App::ObjectStatus::PendingRecompute)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! in console mode there is no event loop to report the end of a HLR task, so a view that has
+//! deferred its HLR (see canDeferHlr) is finished by its owner, or by its next execute
+void DrawViewPart::finishDeferredHlr()
+{
+    if (DU::isGuiUp() || !waitingForHlr()) {
+        return;
+    }
+
+    try {
+        m_hlrFuture.waitForFinished();
+    }
+    catch (...) {
+        waitingForHlr(false);
+        m_tempGeometryObject = nullptr;
+        Base::Console().Error("DVP::finishDeferredHlr - %s - HLR failed\n", getNameInDocument());
+        throw Base::RuntimeError("DVP::finishDeferredHlr - error projecting shape");
+    }
+    //onHlrFinished asks for the new geometry, which must not try to finish it again
+    waitingForHlr(false);
+    onHlrFinished();
+}
+
+//! the geometry of a view with a deferred HLR is only complete once the result is collected, so
+//! the accessors collect it first if the owner has not done so yet
+void DrawViewPart::collectDeferredHlr() const
+{
+    if (DU::isGuiUp() || !waitingForHlr()) {
+        return;
+    }
+
+    try {
+        const_cast<DrawViewPart*>(this)->finishDeferredHlr();
+    }
+    catch (const Base::Exception&) {
+        //already reported, the view keeps its previous geometry
+    }
+}
+
 //! prepare the shape for HLR processing by centering, scaling and rotating it
 GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
 {
@@ -347,6 +405,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    go->setParallelSolids(Preferences::parallelHlrSolids());
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
@@ -355,9 +414,10 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         return go;
     }
 
-    if (!DU::isGuiUp()) {
+    if (!DU::isGuiUp() && !canDeferHlr()) {
         // if the Gui is not running (actual the event loop), we cannot use the separate thread,
-        // since we will never be notified of thread completion.
+        // since we will never be notified of thread completion. Unless someone else collects
+        // the result, see finishDeferredHlr.
         go->projectShape(shape, viewAxis);
         return go;
     }
@@ -366,15 +426,19 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
     //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
     //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-    connectHlrWatcher = QObject::connect(&m_hlrWatcher, &QFutureWatcherBase::finished,
-                                         &m_hlrWatcher, [this] { this->onHlrFinished(); });
+    if (DU::isGuiUp()) {
+        connectHlrWatcher = QObject::connect(&m_hlrWatcher, &QFutureWatcherBase::finished,
+                                             &m_hlrWatcher, [this] { this->onHlrFinished(); });
+    }
 
     // We create a lambda closure to hold a copy of go, shape and viewAxis.
     // This is important because those variables might be local to the calling
     // function and might get destructed before the parallel processing finishes.
     auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-    m_hlrFuture = QtConcurrent::run(std::move(lambda));
-    m_hlrWatcher.setFuture(m_hlrFuture);
+    m_hlrFuture = QtConcurrent::run(HLRScheduler::instance().pool(), std::move(lambda));
+    if (DU::isGuiUp()) {
+        m_hlrWatcher.setFuture(m_hlrFuture);
+    }
     waitingForHlr(true);
 
     return go;
@@ -425,7 +489,7 @@ void DrawViewPart::onHlrFinished()
                                  [this] { this->onFacesFinished(); });
 
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
+            m_faceFuture = QtConcurrent::run(HLRScheduler::instance().pool(), std::move(lambda));
             m_faceWatcher.setFuture(m_faceFuture);
             waitingForFaces(true);
         }
@@ -509,11 +573,48 @@ void DrawViewPart::extractFaces()
         return;
     }
 
+    //faces depend only on the face edges and the face finding settings
+    std::string cacheKey;
+    if (HLRCache::isEnabled()) {
+        std::vector<TopoDS_Edge> edges;
+        for (auto& edge : goEdges) {
+            edges.push_back(edge->getOCCEdge());
+        }
+        cacheKey = HLRCache::makeFaceKey(edges, newFaceFinder(), ScrubCount.getValue());
+        std::vector<TopoDS_Shape> cached;
+        if (HLRCache::load(cacheKey, cached)) {
+            geometryObject->clearFaceGeom();
+            for (auto& faceWires : cached) {
+                TechDraw::FacePtr face(std::make_shared<TechDraw::Face>());
+                for (TopExp_Explorer wires(faceWires, TopAbs_WIRE); wires.More(); wires.Next()) {
+                    face->wires.push_back(new TechDraw::Wire(TopoDS::Wire(wires.Current())));
+                }
+                geometryObject->addFaceGeom(face);
+            }
+            return;
+        }
+    }
+
     if (newFaceFinder()) {
         findFacesNew(goEdges);
     } else {
         findFacesOld(goEdges);
     }
+
+    if (!cacheKey.empty()) {
+        //one compound with the wires of each face
+        std::vector<TopoDS_Shape> faces;
+        BRep_Builder builder;
+        for (auto& face : geometryObject->getFaceGeometry()) {
+            TopoDS_Compound faceWires;
+            builder.MakeCompound(faceWires);
+            for (auto& wire : face->wires) {
+                builder.Add(faceWires, wire->toOccWire());
+            }
+            faces.push_back(faceWires);
+        }
+        HLRCache::save(cacheKey, faces);
+    }
 }
 
 // use the revised face finder algo
@@ -604,60 +705,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -778,6 +826,7 @@ std::vector<TechDraw::DrawViewBalloon*> DrawViewPart::getBalloons() const
 
 const std::vector<TechDraw::VertexPtr> DrawViewPart::getVertexGeometry() const
 {
+    collectDeferredHlr();
     if (geometryObject) {
         return geometryObject->getVertexGeometry();
     }
@@ -830,6 +879,7 @@ TechDraw::FacePtr DrawViewPart::getFace(std::string faceName) const
 
 const std::vector<TechDraw::FacePtr> DrawViewPart::getFaceGeometry() const
 {
+    collectDeferredHlr();
     std::vector<TechDraw::FacePtr> result;
     if (waitingForFaces() || !geometryObject) {
         return std::vector<TechDraw::FacePtr>();
@@ -837,8 +887,15 @@ const std::vector<TechDraw::FacePtr> DrawViewPart::getFaceGeometry() const
     return geometryObject->getFaceGeometry();
 }
 
+TechDraw::GeometryObjectPtr DrawViewPart::getGeometryObject() const
+{
+    collectDeferredHlr();
+    return geometryObject;
+}
+
 const BaseGeomPtrVector DrawViewPart::getEdgeGeometry() const
 {
+    collectDeferredHlr();
     if (geometryObject) {
         return geometryObject->getEdgeGeometry();
     }
@@ -927,7 +984,11 @@ std::vector<TopoDS_Wire> DrawViewPart::getWireForFace(int idx) const
     return result;
 }
 
-Base::BoundBox3d DrawViewPart::getBoundingBox() const { return bbox; }
+Base::BoundBox3d DrawViewPart::getBoundingBox() const
+{
+    collectDeferredHlr();
+    return bbox;
+}
 
 double DrawViewPart::getBoxX() const
 {
@@ -952,6 +1013,7 @@ QRectF DrawViewPart::getRect() const
 //returns a compound of all the visible projected edges
 TopoDS_Shape DrawViewPart::getEdgeCompound() const
 {
+    collectDeferredHlr();
     BRep_Builder builder;
     TopoDS_Compound result;
     builder.MakeCompound(result);
@@ -1041,6 +1103,7 @@ bool DrawViewPart::waitingForResult() const
 
 bool DrawViewPart::hasGeometry() const
 {
+    collectDeferredHlr();
     if (!geometryObject) {
         return false;
     }
@@ -1175,6 +1238,7 @@ std::vector<DrawViewDetail*> DrawViewPart::getDetailRefs() const
 
 const BaseGeomPtrVector DrawViewPart::getVisibleFaceEdges() const
 {
+    collectDeferredHlr();
     return geometryObject->getVisibleFaceEdges(SmoothVisible.getValue(), SeamVisible.getValue());
 }
 
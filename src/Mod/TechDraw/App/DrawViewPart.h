@@ -158,7 +158,7 @@ public:
     const std::vector<TechDraw::FacePtr> getFaceGeometry() const;
 
     bool hasGeometry() const;
-    TechDraw::GeometryObjectPtr getGeometryObject() const { return geometryObject; }
+    TechDraw::GeometryObjectPtr getGeometryObject() const;
 
     TechDraw::VertexPtr getVertex(std::string vertexName) const;
     TechDraw::BaseGeomPtr getEdge(std::string edgeName) const;
@@ -237,6 +237,8 @@ public:
     bool waitingForHlr() const { return m_waitingForHlr; }
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
+    virtual bool canDeferHlr() const;
+    void finishDeferredHlr();
     void progressValueChanged(int v);
 
     bool isCosmeticVertex(const std::string& element);
@@ -249,6 +251,7 @@ public Q_SLOTS:
 
 protected:
     bool checkXDirection() const;
+    void collectDeferredHlr() const;
 
     TechDraw::GeometryObjectPtr geometryObject;
     TechDraw::GeometryObjectPtr m_tempGeometryObject;//holds the new GO until hlr is completed
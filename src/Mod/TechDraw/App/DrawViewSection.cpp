@@ -396,6 +396,7 @@ App::DocumentObjectExecReturn* DrawViewSection::execute()
         return new App::DocumentObjectExecReturn("BaseView object not found");
     }
 
+    finishDeferredHlr();
     if (waitingForCut() || waitingForHlr()) {
         return DrawView::execute();
     }
@@ -628,7 +629,7 @@ void DrawViewSection::onSectionCutFinished()
 
     // display geometry for cut shape is in geometryObject as in DVP
     m_tempGeometryObject = buildGeometryObject(m_preparedShape, getProjectionCS());
-    if (!DU::isGuiUp()) {
+    if (!DU::isGuiUp() && !waitingForHlr()) {
         onHlrFinished();
     }
 }
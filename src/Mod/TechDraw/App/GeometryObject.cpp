@@ -49,8 +49,10 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Ax1.hxx>
@@ -60,10 +62,16 @@
 #include <gp_Pln.hxx>
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
+#include <QThread>
+#include <QtConcurrentMap>
 #endif// #ifndef _PreComp_
 
 #include <algorithm>
+#include <array>
+#include <cfloat>
 #include <chrono>
+#include <map>
+#include <numeric>
 
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -74,6 +82,7 @@
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
 #include "DrawProjectSplit.h"
+#include "HLRCache.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -83,7 +92,7 @@ using DU = DrawUtil;
 
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_scrubCount(0), m_parallelSolids(false)
 
 {}
 
@@ -140,17 +149,57 @@ void GeometryObject::clear()
     edgeGeom.clear();
 }
 
-void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
+namespace
 {
-    clear();
+using HlrCompounds = GeometryObject::HlrCompounds;
+
+//! the members of HlrCompounds in the order they are stored in the HLRCache
+const std::array<TopoDS_Shape HlrCompounds::*, 10> hlrMembers {
+    &HlrCompounds::visHard,   &HlrCompounds::visOutline, &HlrCompounds::visSmooth,
+    &HlrCompounds::visSeam,   &HlrCompounds::visIso,     &HlrCompounds::hidHard,
+    &HlrCompounds::hidOutline, &HlrCompounds::hidSmooth, &HlrCompounds::hidSeam,
+    &HlrCompounds::hidIso};
+constexpr size_t hlrCompoundCount = hlrMembers.size();
+
+std::vector<TopoDS_Shape> toShapes(const HlrCompounds& hlr)
+{
+    std::vector<TopoDS_Shape> shapes;
+    for (auto member : hlrMembers) {
+        shapes.push_back(hlr.*member);
+    }
+    return shapes;
+}
+
+HlrCompounds fromShapes(const std::vector<TopoDS_Shape>& shapes)
+{
+    HlrCompounds hlr;
+    for (size_t i = 0; i < hlrCompoundCount; i++) {
+        hlr.*hlrMembers[i] = shapes[i];
+    }
+    return hlr;
+}
 
+//! rebuild the 3d curves of a HLR compound and move it back into the view plane
+TopoDS_Shape finishCompound(const TopoDS_Shape& compound)
+{
+    if (compound.IsNull()) {
+        return compound;
+    }
+    TopoDS_Shape result = compound;
+    BRepLib::BuildCurves3d(result);
+    return ShapeUtils::invertGeometry(result);
+}
+
+HlrCompounds runHlr(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis, int isoCount,
+                    bool isPersp, double focus)
+{
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
         //        brep_hlr->Debug(true);
-        brep_hlr->Add(inShape, m_isoCount);
-        if (m_isPersp) {
-            double fLength = std::max(Precision::Confusion(), m_focus);
+        brep_hlr->Add(inShape, isoCount);
+        if (isPersp) {
+            double fLength = std::max(Precision::Confusion(), focus);
             HLRAlgo_Projector projector(viewAxis, fLength);
             brep_hlr->Projector(projector);
         }
@@ -170,79 +219,278 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
         throw Base::RuntimeError("GeometryObject::projectShape - unknown error");
     }
 
+    HlrCompounds result;
     try {
         HLRBRep_HLRToShape hlrToShape(brep_hlr);
 
-        if (!hlrToShape.VCompound().IsNull()) {
-            visHard = hlrToShape.VCompound();
-            BRepLib::BuildCurves3d(visHard);
-            visHard =ShapeUtils::invertGeometry(visHard);
-            //            BRepTools::Write(visHard, "GOvisHard.brep");            //debug
-        }
+        result.visHard = finishCompound(hlrToShape.VCompound());
+        //            BRepTools::Write(result.visHard, "GOvisHard.brep");            //debug
+        result.visSmooth = finishCompound(hlrToShape.Rg1LineVCompound());
+        result.visSeam = finishCompound(hlrToShape.RgNLineVCompound());
+        //            BRepTools::Write(hlrToShape.OutLineVCompound(), "GOOutLineVCompound.brep");            //debug
+        result.visOutline = finishCompound(hlrToShape.OutLineVCompound());
+        result.visIso = finishCompound(hlrToShape.IsoLineVCompound());
+        result.hidHard = finishCompound(hlrToShape.HCompound());
+        result.hidSmooth = finishCompound(hlrToShape.Rg1LineHCompound());
+        result.hidSeam = finishCompound(hlrToShape.RgNLineHCompound());
+        result.hidOutline = finishCompound(hlrToShape.OutLineHCompound());
+        result.hidIso = finishCompound(hlrToShape.IsoLineHCompound());
+    }
+    catch (const Standard_Failure&) {
+        throw Base::RuntimeError(
+            "GeometryObject::projectShape - OCC error occurred while extracting edges");
+    }
+    catch (...) {
+        throw Base::RuntimeError(
+            "GeometryObject::projectShape - unknown error occurred while extracting edges");
+    }
+    return result;
+}
 
-        if (!hlrToShape.Rg1LineVCompound().IsNull()) {
-            visSmooth = hlrToShape.Rg1LineVCompound();
-            BRepLib::BuildCurves3d(visSmooth);
-            visSmooth =ShapeUtils::invertGeometry(visSmooth);
+//! combine the non null shapes into one compound
+TopoDS_Shape mergeCompounds(const std::vector<TopoDS_Shape>& shapes)
+{
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    bool empty = true;
+    for (auto& shape : shapes) {
+        if (shape.IsNull()) {
+            continue;
+        }
+        if (empty) {
+            builder.MakeCompound(result);
+            empty = false;
         }
+        builder.Add(result, shape);
+    }
+    return result;
+}
+
+void addHlrItems(const TopoDS_Shape& shape, std::vector<TopoDS_Shape>& items)
+{
+    if (shape.ShapeType() != TopAbs_COMPOUND) {
+        items.push_back(shape);
+        return;
+    }
+    for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+        addHlrItems(it.Value(), items);
+    }
+}
+
+//! the rectangle covered by an item in the (orthographic) view plane
+struct ViewRect
+{
+    double xMin, xMax, yMin, yMax;
+};
 
-        if (!hlrToShape.RgNLineVCompound().IsNull()) {
-            visSeam = hlrToShape.RgNLineVCompound();
-            BRepLib::BuildCurves3d(visSeam);
-            visSeam =ShapeUtils::invertGeometry(visSeam);
+int findRoot(std::vector<int>& parents, int i)
+{
+    while (parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+}// namespace
+
+//! Split a compound into batches whose rectangles in the view don't overlap.  Shapes that
+//! don't overlap in the view can't hide each other, so the hidden lines of the batches can be
+//! removed separately and the results merged.  The batches are sorted along the view's X
+//! direction and have roughly the same number of faces.  Returns an empty vector if the shape
+//! can't be split.
+std::vector<TopoDS_Shape> GeometryObject::splitForHlr(const TopoDS_Shape& inShape,
+                                                      const gp_Ax2& viewAxis, int maxBatches)
+{
+    std::vector<TopoDS_Shape> items;
+    addHlrItems(inShape, items);
+    if (items.size() < 2 || maxBatches < 2) {
+        return {};
+    }
+
+    int itemCount = items.size();
+    gp_Vec origin(viewAxis.Location().XYZ());
+    gp_Vec xDir(viewAxis.XDirection());
+    gp_Vec yDir(viewAxis.YDirection());
+    std::vector<ViewRect> rects(itemCount);
+    for (int iItem = 0; iItem < itemCount; iItem++) {
+        Bnd_Box box;
+        BRepBndLib::Add(items[iItem], box);
+        if (box.IsVoid()) {
+            //nothing to see, so it can go with any other item
+            rects[iItem] = {0.0, 0.0, 0.0, 0.0};
+            continue;
+        }
+        box.SetGap(Precision::Confusion());
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        ViewRect& rect = rects[iItem];
+        rect = {DBL_MAX, -DBL_MAX, DBL_MAX, -DBL_MAX};
+        for (int corner = 0; corner < 8; corner++) {
+            gp_Vec point((corner & 1) ? xMax : xMin,
+                         (corner & 2) ? yMax : yMin,
+                         (corner & 4) ? zMax : zMin);
+            double x = (point - origin).Dot(xDir);
+            double y = (point - origin).Dot(yDir);
+            rect.xMin = std::min(rect.xMin, x);
+            rect.xMax = std::max(rect.xMax, x);
+            rect.yMin = std::min(rect.yMin, y);
+            rect.yMax = std::max(rect.yMax, y);
         }
+    }
 
-        if (!hlrToShape.OutLineVCompound().IsNull()) {
-            //            BRepTools::Write(hlrToShape.OutLineVCompound(), "GOOutLineVCompound.brep");            //debug
-            visOutline = hlrToShape.OutLineVCompound();
-            BRepLib::BuildCurves3d(visOutline);
-            visOutline =ShapeUtils::invertGeometry(visOutline);
+    //group the items with overlapping rectangles by sweeping along x
+    std::vector<int> order(itemCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&rects](int i1, int i2) {
+        return rects[i1].xMin < rects[i2].xMin;
+    });
+    std::vector<int> parents(itemCount);
+    std::iota(parents.begin(), parents.end(), 0);
+    std::vector<int> active;
+    for (int iItem : order) {
+        const ViewRect& rect = rects[iItem];
+        auto ended = std::remove_if(active.begin(), active.end(), [&](int other) {
+            return rects[other].xMax < rect.xMin;
+        });
+        active.erase(ended, active.end());
+        for (int other : active) {
+            if (rects[other].yMax >= rect.yMin && rect.yMax >= rects[other].yMin) {
+                parents[findRoot(parents, iItem)] = findRoot(parents, other);
+            }
         }
+        active.push_back(iItem);
+    }
 
-        if (!hlrToShape.IsoLineVCompound().IsNull()) {
-            visIso = hlrToShape.IsoLineVCompound();
-            BRepLib::BuildCurves3d(visIso);
-            visIso =ShapeUtils::invertGeometry(visIso);
+    //collect the groups in the order of their leftmost item
+    std::map<int, int> groupOfRoot;
+    std::vector<std::vector<int>> groups;
+    for (int iItem : order) {
+        int root = findRoot(parents, iItem);
+        auto found = groupOfRoot.find(root);
+        if (found == groupOfRoot.end()) {
+            found = groupOfRoot.emplace(root, int(groups.size())).first;
+            groups.emplace_back();
         }
+        groups[found->second].push_back(iItem);
+    }
+    if (groups.size() < 2) {
+        return {};
+    }
 
-        if (!hlrToShape.HCompound().IsNull()) {
-            hidHard = hlrToShape.HCompound();
-            BRepLib::BuildCurves3d(hidHard);
-            hidHard =ShapeUtils::invertGeometry(hidHard);
+    std::vector<int> faceCounts(groups.size(), 0);
+    int totalFaces = 0;
+    for (size_t iGroup = 0; iGroup < groups.size(); iGroup++) {
+        for (int iItem : groups[iGroup]) {
+            for (TopExp_Explorer faces(items[iItem], TopAbs_FACE); faces.More(); faces.Next()) {
+                faceCounts[iGroup]++;
+            }
         }
+        totalFaces += faceCounts[iGroup];
+    }
 
-        if (!hlrToShape.Rg1LineHCompound().IsNull()) {
-            hidSmooth = hlrToShape.Rg1LineHCompound();
-            BRepLib::BuildCurves3d(hidSmooth);
-            hidSmooth =ShapeUtils::invertGeometry(hidSmooth);
+    int batchCount = std::min<int>(maxBatches, groups.size());
+    double facesPerBatch = std::max(1.0, double(totalFaces) / batchCount);
+    std::vector<TopoDS_Shape> batches;
+    BRep_Builder builder;
+    TopoDS_Compound batch;
+    builder.MakeCompound(batch);
+    int batchFaces = 0;
+    int remainingGroups = groups.size();
+    for (size_t iGroup = 0; iGroup < groups.size(); iGroup++) {
+        for (int iItem : groups[iGroup]) {
+            builder.Add(batch, items[iItem]);
+        }
+        batchFaces += faceCounts[iGroup];
+        remainingGroups--;
+        int remainingBatches = batchCount - int(batches.size()) - 1;
+        if (remainingGroups > 0 && remainingBatches > 0
+            && (batchFaces >= facesPerBatch || remainingGroups <= remainingBatches)) {
+            batches.push_back(batch);
+            builder.MakeCompound(batch);
+            batchFaces = 0;
         }
+    }
+    batches.push_back(batch);
+    return batches;
+}
+
+void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
+{
+    clear();
 
-        if (!hlrToShape.RgNLineHCompound().IsNull()) {
-            hidSeam = hlrToShape.RgNLineHCompound();
-            BRepLib::BuildCurves3d(hidSeam);
-            hidSeam =ShapeUtils::invertGeometry(hidSeam);
+    HlrCompounds hlr;
+    std::string cacheKey;
+    if (HLRCache::isEnabled()) {
+        cacheKey = HLRCache::makeKey(inShape, viewAxis, m_isoCount, m_isPersp, m_focus);
+        std::vector<TopoDS_Shape> cached;
+        if (HLRCache::load(cacheKey, cached) && cached.size() == hlrCompoundCount) {
+            setHlrCompounds(fromShapes(cached));
+            return;
         }
+    }
+
+    std::vector<TopoDS_Shape> batches;
+    if (m_parallelSolids && !m_isPersp) {
+        batches = splitForHlr(inShape, viewAxis, QThread::idealThreadCount());
+    }
 
-        if (!hlrToShape.OutLineHCompound().IsNull()) {
-            hidOutline = hlrToShape.OutLineHCompound();
-            BRepLib::BuildCurves3d(hidOutline);
-            hidOutline =ShapeUtils::invertGeometry(hidOutline);
+    if (batches.size() < 2) {
+        hlr = runHlr(inShape, viewAxis, m_isoCount, m_isPersp, m_focus);
+    }
+    else {
+        //exceptions can't leave the worker threads, so they are passed on here
+        std::vector<std::string> errors(batches.size());
+        std::vector<HlrCompounds> results(batches.size());
+        std::vector<int> indexes(batches.size());
+        std::iota(indexes.begin(), indexes.end(), 0);
+        QtConcurrent::blockingMap(indexes, [&](int iBatch) {
+            try {
+                results[iBatch] = runHlr(batches[iBatch], viewAxis, m_isoCount, m_isPersp, m_focus);
+            }
+            catch (const Base::Exception& e) {
+                errors[iBatch] = e.what();
+            }
+        });
+        for (auto& error : errors) {
+            if (!error.empty()) {
+                throw Base::RuntimeError(error);
+            }
         }
 
-        if (!hlrToShape.IsoLineHCompound().IsNull()) {
-            hidIso = hlrToShape.IsoLineHCompound();
-            BRepLib::BuildCurves3d(hidIso);
-            hidIso =ShapeUtils::invertGeometry(hidIso);
+        for (auto member : hlrMembers) {
+            std::vector<TopoDS_Shape> shapes;
+            for (auto& result : results) {
+                shapes.push_back(result.*member);
+            }
+            hlr.*member = mergeCompounds(shapes);
         }
     }
-    catch (const Standard_Failure&) {
-        throw Base::RuntimeError(
-            "GeometryObject::projectShape - OCC error occurred while extracting edges");
-    }
-    catch (...) {
-        throw Base::RuntimeError(
-            "GeometryObject::projectShape - unknown error occurred while extracting edges");
+
+    if (!cacheKey.empty()) {
+        HLRCache::save(cacheKey, toShapes(hlr));
     }
+    setHlrCompounds(hlr);
+}
+
+//! take over the output of HLR and convert it into TD geometry
+void GeometryObject::setHlrCompounds(const HlrCompounds& hlr)
+{
+    //only replace the members that received output, as before
+    auto assign = [](TopoDS_Shape& member, const TopoDS_Shape& shape) {
+        if (!shape.IsNull()) {
+            member = shape;
+        }
+    };
+    assign(visHard, hlr.visHard);
+    assign(visOutline, hlr.visOutline);
+    assign(visSmooth, hlr.visSmooth);
+    assign(visSeam, hlr.visSeam);
+    assign(visIso, hlr.visIso);
+    assign(hidHard, hlr.hidHard);
+    assign(hidOutline, hlr.hidOutline);
+    assign(hidSmooth, hlr.hidSmooth);
+    assign(hidSeam, hlr.hidSeam);
+    assign(hidIso, hlr.hidIso);
 
     makeTDGeometry();
 }
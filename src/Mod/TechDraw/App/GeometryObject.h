@@ -63,6 +63,21 @@ class Vertex;
 class TechDrawExport GeometryObject
 {
 public:
+    //! the compounds of one run of the exact HLR algorithm
+    struct HlrCompounds
+    {
+        TopoDS_Shape visHard;
+        TopoDS_Shape visOutline;
+        TopoDS_Shape visSmooth;
+        TopoDS_Shape visSeam;
+        TopoDS_Shape visIso;
+        TopoDS_Shape hidHard;
+        TopoDS_Shape hidOutline;
+        TopoDS_Shape hidSmooth;
+        TopoDS_Shape hidSeam;
+        TopoDS_Shape hidIso;
+    };
+
     /// Constructor
     GeometryObject(const std::string& parent, TechDraw::DrawView* parentObj);
     virtual ~GeometryObject();
@@ -98,6 +113,10 @@ public:
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
+    //! remove the hidden lines of independent groups of solids in parallel
+    void setParallelSolids(bool b) { m_parallelSolids = b; }
+    static std::vector<TopoDS_Shape> splitForHlr(const TopoDS_Shape& inShape,
+                                                 const gp_Ax2& viewAxis, int maxBatches);
 
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
@@ -141,6 +160,7 @@ protected:
     TopoDS_Shape hidSeam;
     TopoDS_Shape hidIso;
 
+    void setHlrCompounds(const HlrCompounds& hlr);
     void addGeomFromCompound(TopoDS_Shape edgeCompound, EdgeClass category, bool visible);
     TechDraw::DrawViewDetail* isParentDetail();
 
@@ -165,6 +185,7 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    bool m_parallelSolids;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
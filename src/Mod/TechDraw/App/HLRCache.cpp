@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2025 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QRandomGenerator>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Version.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <gp_Ax2.hxx>
+#endif
+
+#include <App/Application.h>
+#include <Base/FileInfo.h>
+
+#include "HLRCache.h"
+#include "Preferences.h"
+
+
+using namespace TechDraw;
+namespace fs = std::filesystem;
+
+namespace
+{
+//! change this when the stored output of HLR or face finding changes
+constexpr int cacheVersion = 1;
+
+//! serializes the pruning of the cache directory
+std::mutex pruneMutex;
+
+//! temporary files older than this are left over from an interrupted save
+constexpr auto staleTempAge = std::chrono::hours(1);
+
+std::string hashString(const std::string& text)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+#if QT_VERSION < QT_VERSION_CHECK(6, 3, 0)
+    hash.addData(text.c_str(), int(text.size()));
+#else
+    hash.addData(QByteArrayView(text.c_str(), text.size()));
+#endif
+    return hash.result().toHex().toStdString();
+}
+
+void writePoint(std::ostream& out, const gp_XYZ& point)
+{
+    out << point.X() << ' ' << point.Y() << ' ' << point.Z() << '\n';
+}
+
+//! write the geometry of a shape for hashing. A triangulation doesn't change the result of HLR
+//! or face finding, but it comes and goes with the display of the source objects.
+void writeGeometry(std::ostream& out, const TopoDS_Shape& shape)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    BRepTools::Write(shape, out, Standard_False, Standard_False, TopTools_FormatVersion_CURRENT);
+#else
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(shape).Shape();
+    BRepTools::Clean(copy);
+    BRepTools::Write(copy, out);
+#endif
+}
+}// namespace
+
+bool HLRCache::isEnabled()
+{
+    return Preferences::hlrCacheSize() > 0;
+}
+
+std::string HLRCache::makeKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis, int isoCount,
+                              bool isPersp, double focus)
+{
+    std::ostringstream buffer;
+    buffer << std::setprecision(17);
+    buffer << "hlr " << cacheVersion << ' ' << OCC_VERSION_HEX << '\n';
+    writePoint(buffer, viewAxis.Location().XYZ());
+    writePoint(buffer, viewAxis.Direction().XYZ());
+    writePoint(buffer, viewAxis.XDirection().XYZ());
+    buffer << isoCount << ' ' << isPersp << ' ' << focus << '\n';
+    writeGeometry(buffer, shape);
+    return "hlr-" + hashString(buffer.str());
+}
+
+std::string HLRCache::makeFaceKey(const std::vector<TopoDS_Edge>& edges, bool newFaceFinder,
+                                  int scrubCount)
+{
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    for (auto& edge : edges) {
+        builder.Add(compound, edge);
+    }
+
+    std::ostringstream buffer;
+    buffer << "faces " << cacheVersion << ' ' << OCC_VERSION_HEX << '\n';
+    buffer << newFaceFinder << ' ' << scrubCount << '\n';
+    writeGeometry(buffer, compound);
+    return "faces-" + hashString(buffer.str());
+}
+
+bool HLRCache::load(const std::string& key, std::vector<TopoDS_Shape>& shapes)
+{
+    std::string dir = cacheDirectory();
+    if (dir.empty()) {
+        return false;
+    }
+    fs::path path = Base::FileInfo::stringToPath(dir + key + ".brep");
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    TopoDS_Shape entry;
+    try {
+        BRep_Builder builder;
+        BRepTools::Read(entry, file, builder);
+    }
+    catch (const Standard_Failure&) {
+        return false;
+    }
+    if (entry.IsNull() || entry.ShapeType() != TopAbs_COMPOUND) {
+        return false;
+    }
+
+    shapes.clear();
+    for (TopoDS_Iterator it(entry); it.More(); it.Next()) {
+        const TopoDS_Shape& shape = it.Value();
+        shapes.push_back(TopoDS_Iterator(shape).More() ? shape : TopoDS_Shape());
+    }
+
+    //mark the entry as recently used
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void HLRCache::save(const std::string& key, const std::vector<TopoDS_Shape>& shapes)
+{
+    std::string dir = cacheDirectory();
+    if (dir.empty()) {
+        return;
+    }
+
+    BRep_Builder builder;
+    TopoDS_Compound entry;
+    builder.MakeCompound(entry);
+    for (auto& shape : shapes) {
+        if (shape.IsNull()) {
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(entry, empty);
+        }
+        else {
+            builder.Add(entry, shape);
+        }
+    }
+
+    //several threads or processes sharing the cache may save the same entry, so write to a file
+    //of our own and rename it
+    fs::path path = Base::FileInfo::stringToPath(dir + key + ".brep");
+    std::ostringstream tempName;
+    tempName << dir << key << '.' << QCoreApplication::applicationPid() << '.'
+             << std::this_thread::get_id() << '.' << std::hex
+             << QRandomGenerator::global()->generate64() << ".tmp";
+    fs::path tempPath = Base::FileInfo::stringToPath(tempName.str());
+    try {
+        std::ofstream file(tempPath, std::ios::binary);
+        if (!file) {
+            return;
+        }
+        BRepTools::Write(entry, file);
+    }
+    catch (const Standard_Failure&) {
+        std::error_code ec;
+        fs::remove(tempPath, ec);
+        return;
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, path, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return;
+    }
+
+    prune(std::uintmax_t(Preferences::hlrCacheSize()) * 1024 * 1024);
+}
+
+std::string HLRCache::cacheDirectory()
+{
+    std::string dir = App::Application::getUserCachePath() + "TechDraw/HLR/";
+    std::error_code ec;
+    fs::create_directories(Base::FileInfo::stringToPath(dir), ec);
+    if (ec) {
+        return {};
+    }
+    return dir;
+}
+
+//! remove the least recently used entries until the cache fits into maxBytes, and any stale
+//! temporary files
+void HLRCache::prune(std::uintmax_t maxBytes)
+{
+    std::lock_guard<std::mutex> lock(pruneMutex);
+
+    struct Entry
+    {
+        fs::path path;
+        fs::file_time_type time;
+        std::uintmax_t size;
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t totalBytes = 0;
+    std::error_code ec;
+    fs::path dir = Base::FileInfo::stringToPath(cacheDirectory());
+    auto now = fs::file_time_type::clock::now();
+    for (const auto& it : fs::directory_iterator(dir, ec)) {
+        if (it.path().extension() == ".tmp") {
+            //a recent one may still be written by another thread
+            auto time = it.last_write_time(ec);
+            if (!ec && now - time > staleTempAge) {
+                fs::remove(it.path(), ec);
+            }
+            continue;
+        }
+        if (it.path().extension() != ".brep") {
+            continue;
+        }
+        Entry entry {it.path(), it.last_write_time(ec), it.file_size(ec)};
+        if (ec) {
+            continue;
+        }
+        totalBytes += entry.size;
+        entries.push_back(entry);
+    }
+    if (totalBytes <= maxBytes) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& e1, const Entry& e2) {
+        return e1.time < e2.time;
+    });
+    for (auto& entry : entries) {
+        if (totalBytes <= maxBytes) {
+            break;
+        }
+        if (fs::remove(entry.path, ec)) {
+            totalBytes -= entry.size;
+        }
+    }
+}
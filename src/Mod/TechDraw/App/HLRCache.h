@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2025 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+
+#ifndef TECHDRAW_HLRCACHE_H
+#define TECHDRAW_HLRCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+class gp_Ax2;
+
+namespace TechDraw
+{
+
+/**
+ * HLRCache keeps the results of the hidden line removal and of the face finding in the user's
+ * cache directory, so that they are not computed again when a document is opened or a view is
+ * recomputed with unchanged input.
+ * The entries are addressed by a hash of the input: the shape as it is passed to HLR (already
+ * centered, scaled and rotated) and the projection parameters, or the face edges and the face
+ * finding settings. Each entry is a BREP file with a compound of the stored shapes in order.
+ * The least recently used entries are removed when the cache exceeds its size.
+ */
+class TechDrawExport HLRCache
+{
+public:
+    //! the cache is disabled if its size in the preferences is 0
+    static bool isEnabled();
+
+    static std::string makeKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis, int isoCount,
+                               bool isPersp, double focus);
+    static std::string makeFaceKey(const std::vector<TopoDS_Edge>& edges, bool newFaceFinder,
+                                   int scrubCount);
+
+    //! returns false if there is no entry for key.  Null shapes and empty compounds are both
+    //! returned as null shapes.
+    static bool load(const std::string& key, std::vector<TopoDS_Shape>& shapes);
+    static void save(const std::string& key, const std::vector<TopoDS_Shape>& shapes);
+
+private:
+    static std::string cacheDirectory();
+    static void prune(std::uintmax_t maxBytes);
+};
+
+}// namespace TechDraw
+
+#endif// TECHDRAW_HLRCACHE_H
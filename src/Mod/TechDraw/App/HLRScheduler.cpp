@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2025 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <QThread>
+#endif
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+
+#include "HLRScheduler.h"
+#include "ShapeExtractor.h"
+
+
+using namespace TechDraw;
+
+HLRScheduler& HLRScheduler::instance()
+{
+    static HLRScheduler scheduler;
+    return scheduler;
+}
+
+HLRScheduler::HLRScheduler()
+{
+    m_pool.setMaxThreadCount(QThread::idealThreadCount());
+
+    //the shared source shapes are only valid during one recompute
+    m_connectBeforeRecompute = App::GetApplication().signalBeforeRecomputeDocument.connect(
+        [this](const App::Document& doc) { onRecompute(doc); });
+    m_connectRecomputed = App::GetApplication().signalRecomputed.connect(
+        [this](const App::Document& doc) { onRecompute(doc); });
+}
+
+HLRScheduler::~HLRScheduler()
+{
+    m_pool.waitForDone();
+}
+
+TopoDS_Shape HLRScheduler::getSourceShape(const std::vector<App::DocumentObject*>& links,
+                                          bool fuse)
+{
+    if (links.empty()) {
+        return TopoDS_Shape();
+    }
+
+    App::Document* doc = links.front()->getDocument();
+    if (!doc || !doc->testStatus(App::Document::Recomputing)) {
+        //outside of a recompute the sources may change at any time
+        return fuse ? ShapeExtractor::getShapesFused(links) : ShapeExtractor::getShapes(links);
+    }
+
+    SourceKey key(links, fuse);
+    auto found = m_sourceShapes.find(key);
+    if (found != m_sourceShapes.end()) {
+        return found->second;
+    }
+    TopoDS_Shape shape =
+        fuse ? ShapeExtractor::getShapesFused(links) : ShapeExtractor::getShapes(links);
+    m_sourceShapes.emplace(key, shape);
+    return shape;
+}
+
+void HLRScheduler::clearSourceShapes()
+{
+    m_sourceShapes.clear();
+}
+
+void HLRScheduler::onRecompute(const App::Document& doc)
+{
+    (void)doc;
+    clearSourceShapes();
+}
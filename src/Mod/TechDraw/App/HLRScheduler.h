@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2025 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+
+#ifndef TECHDRAW_HLRSCHEDULER_H
+#define TECHDRAW_HLRSCHEDULER_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <QThreadPool>
+#include <boost/signals2.hpp>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+namespace App
+{
+class Document;
+class DocumentObject;
+}
+
+namespace TechDraw
+{
+
+/**
+ * HLRScheduler coordinates the hidden line removal of the views of all pages.
+ * The HLR and face finding tasks of the views run in a thread pool of their own, in the Gui
+ * as well as in console mode, where the views of a projection group are finished by the group.
+ * The source shape of views that show the same objects is extracted only once per recompute.
+ */
+class TechDrawExport HLRScheduler
+{
+public:
+    static HLRScheduler& instance();
+
+    HLRScheduler(const HLRScheduler&) = delete;
+    HLRScheduler& operator=(const HLRScheduler&) = delete;
+
+    //! the pool the HLR and face finding tasks run in
+    QThreadPool* pool()
+    {
+        return &m_pool;
+    }
+
+    //! returns the compound of the shapes of links.  While the document is recomputed, views
+    //! with the same sources share the compound.
+    TopoDS_Shape getSourceShape(const std::vector<App::DocumentObject*>& links, bool fuse);
+    void clearSourceShapes();
+
+private:
+    HLRScheduler();
+    ~HLRScheduler();
+
+    void onRecompute(const App::Document& doc);
+
+    using SourceKey = std::pair<std::vector<App::DocumentObject*>, bool>;
+    std::map<SourceKey, TopoDS_Shape> m_sourceShapes;
+    QThreadPool m_pool;
+    boost::signals2::scoped_connection m_connectBeforeRecompute;
+    boost::signals2::scoped_connection m_connectRecomputed;
+};
+
+}// namespace TechDraw
+
+#endif// TECHDRAW_HLRSCHEDULER_H
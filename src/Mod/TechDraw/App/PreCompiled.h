@@ -35,19 +35,24 @@
 #include <algorithm>
 #include <cstdio>
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 // boost
 #include <boost/graph/boyer_myrvold_planar_test.hpp>
 #include <boost/graph/is_kuratowski_subgraph.hpp>
 #include <boost/random.hpp>
+#include <boost/signals2.hpp>
 #include <boost/thread/lock_guard.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -57,16 +62,22 @@
 // Qt
 #include <QApplication>
 #include <QCollator>
+#include <QCryptographicHash>
 #include <QDateTime>
 #include <QDomDocument>
 #include <QFile>
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentMap>
 #include <QtConcurrentRun>
 
 // OpenCasCade
 #include <Mod/Part/App/OpenCascadeAll.h>
+#include <Bnd_BoundSortBox.hxx>
+#include <Bnd_HArray1OfBox.hxx>
 
 #endif // _PreComp_
 #endif
@@ -440,6 +440,19 @@ int Preferences::scrubCount()
     return getPreferenceGroup("General")->GetInt("ScrubCount", 1);
 }
 
+//! if true, compounds of many solids are split into batches that do not overlap in the view
+//! and the hidden lines of the batches are removed in parallel
+bool Preferences::parallelHlrSolids()
+{
+    return getPreferenceGroup("General")->GetBool("ParallelHlrSolids", false);
+}
+
+//! the size of the cache of HLR and face finding results in MB.  0 disables the cache.
+int Preferences::hlrCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("HlrCacheSize", 200);
+}
+
 //! Returns the factor for the overlap of svg tiles when hatching faces
 double Preferences::svgHatchFactor()
 {
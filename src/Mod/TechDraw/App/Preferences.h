@@ -110,6 +110,8 @@ public:
 
     static bool autoCorrectDimRefs();
     static int scrubCount();
+    static bool parallelHlrSolids();
+    static int hlrCacheSize();
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
@@ -0,0 +1,120 @@
+import FreeCAD
+import os
+import random
+import unittest
+from .TechDrawTestUtilities import createPageWithSVGTemplate
+
+
+def edgeSignature(edges):
+    """Returns the end points and lengths of the edges, rounded and sorted, so that the edges of
+    two views can be compared regardless of their order"""
+    signature = []
+    for edge in edges:
+        points = sorted(
+            (round(v.Point.x, 3), round(v.Point.y, 3), round(v.Point.z, 3)) for v in edge.Vertexes
+        )
+        signature.append((tuple(points), round(edge.Length, 3)))
+    return sorted(signature)
+
+
+class DrawViewPartCacheTest(unittest.TestCase):
+    def setUp(self):
+        """Creates a page and a view with the HLR cache enabled"""
+        FreeCAD.newDocument("TDCache")
+        FreeCAD.setActiveDocument("TDCache")
+        FreeCAD.ActiveDocument = FreeCAD.getDocument("TDCache")
+        self.document = FreeCAD.ActiveDocument
+
+        self.prefs = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        self.hlrCacheSize = self.prefs.GetInt("HlrCacheSize", 200)
+        self.handleFaces = self.prefs.GetBool("HandleFaces", True)
+        self.prefs.SetInt("HlrCacheSize", 200)
+        self.prefs.SetBool("HandleFaces", True)
+
+        self.cacheDir = os.path.join(FreeCAD.getUserCachePath(), "TechDraw", "HLR")
+        self.entriesBefore = self.cacheEntries()
+
+        # the entries are keyed by the geometry, so give the box a size of its own to not hit
+        # the entries of an earlier run
+        box = self.document.addObject("Part::Box", "Box")
+        box.Length = 10.0 + random.uniform(0.0, 10.0)
+        box.Width = 20.0
+        box.Height = 30.0
+
+        self.page = createPageWithSVGTemplate()
+        self.view = self.document.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(self.view)
+        self.view.Source = [box]
+        self.view.Direction = FreeCAD.Vector(1.0, -1.0, 1.0)
+        self.view.ScaleType = "Custom"
+        self.view.Scale = 1.0
+        self.document.recompute()
+        print("DrawViewPartCache test: view created")
+
+    def tearDown(self):
+        for entry in self.cacheEntries() - self.entriesBefore:
+            os.remove(os.path.join(self.cacheDir, entry))
+        self.prefs.SetInt("HlrCacheSize", self.hlrCacheSize)
+        self.prefs.SetBool("HandleFaces", self.handleFaces)
+        print("DrawViewPartCache test: finished")
+        FreeCAD.closeDocument("TDCache")
+
+    def cacheEntries(self):
+        if not os.path.isdir(self.cacheDir):
+            return set()
+        return {entry for entry in os.listdir(self.cacheDir) if entry.endswith(".brep")}
+
+    def newEntries(self, prefix):
+        return {
+            entry for entry in self.cacheEntries() - self.entriesBefore if entry.startswith(prefix)
+        }
+
+    def recomputeView(self):
+        self.view.touch()
+        self.document.recompute()
+        self.assertTrue("Up-to-date" in self.view.State, "DrawViewPart is not Up-to-date")
+
+    def testCacheHit(self):
+        """Tests if recomputing an unchanged view gives the cached edges and faces"""
+        hlrEntries = self.newEntries("hlr-")
+        faceEntries = self.newEntries("faces-")
+        self.assertEqual(len(hlrEntries), 1, "HLR result was not cached")
+        self.assertEqual(len(faceEntries), 1, "faces were not cached")
+        visible = edgeSignature(self.view.getVisibleEdges())
+        hidden = edgeSignature(self.view.getHiddenEdges())
+        self.assertTrue(visible, "DrawViewPart has no visible edges")
+        self.assertTrue(hidden, "DrawViewPart has no hidden edges")
+
+        self.recomputeView()
+
+        # the faces are found from the edges, so identical edges load the same faces entry
+        self.assertEqual(self.newEntries("hlr-"), hlrEntries)
+        self.assertEqual(self.newEntries("faces-"), faceEntries)
+        self.assertEqual(edgeSignature(self.view.getVisibleEdges()), visible)
+        self.assertEqual(edgeSignature(self.view.getHiddenEdges()), hidden)
+
+    def testCacheMissOnDirection(self):
+        """Tests if changing the Direction of a view misses the cache"""
+        hlrEntries = self.newEntries("hlr-")
+        visible = edgeSignature(self.view.getVisibleEdges())
+
+        self.view.Direction = FreeCAD.Vector(0.0, -1.0, 0.0)
+        self.recomputeView()
+
+        self.assertEqual(len(self.newEntries("hlr-") - hlrEntries), 1)
+        self.assertNotEqual(edgeSignature(self.view.getVisibleEdges()), visible)
+
+    def testCacheMissOnScale(self):
+        """Tests if changing the Scale of a view misses the cache"""
+        hlrEntries = self.newEntries("hlr-")
+        visible = edgeSignature(self.view.getVisibleEdges())
+
+        self.view.Scale = 2.0
+        self.recomputeView()
+
+        self.assertEqual(len(self.newEntries("hlr-") - hlrEntries), 1)
+        self.assertNotEqual(edgeSignature(self.view.getVisibleEdges()), visible)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,122 @@
+import FreeCAD
+import unittest
+from .TechDrawTestUtilities import createPageWithSVGTemplate
+
+
+def edgeSignature(edges):
+    """Returns the end points and lengths of the edges, rounded and sorted, so that the edges of
+    two views can be compared regardless of their order"""
+    signature = []
+    for edge in edges:
+        points = sorted(
+            (round(v.Point.x, 3), round(v.Point.y, 3), round(v.Point.z, 3)) for v in edge.Vertexes
+        )
+        signature.append((tuple(points), round(edge.Length, 3)))
+    return sorted(signature)
+
+
+class DrawViewPartHlrTest(unittest.TestCase):
+    def setUp(self):
+        """Creates a compound of separate solids and a page"""
+        FreeCAD.newDocument("TDHlr")
+        FreeCAD.setActiveDocument("TDHlr")
+        FreeCAD.ActiveDocument = FreeCAD.getDocument("TDHlr")
+        self.document = FreeCAD.ActiveDocument
+
+        # solids that don't overlap in the view are projected separately when the
+        # ParallelHlrSolids preference is set, the box and the cylinder overlap and stay together
+        solids = []
+        for i in range(4):
+            box = self.document.addObject("Part::Box", "Box")
+            base = FreeCAD.Vector(40.0 * i, 0.0, 0.0)
+            box.Placement = FreeCAD.Placement(base, FreeCAD.Rotation())
+            solids.append(box)
+        cylinder = self.document.addObject("Part::Cylinder", "Cylinder")
+        cylinder.Radius = 4.0
+        cylinder.Height = 20.0
+        base = FreeCAD.Vector(85.0, 5.0, -5.0)
+        cylinder.Placement = FreeCAD.Placement(base, FreeCAD.Rotation())
+        solids.append(cylinder)
+        self.compound = self.document.addObject("Part::Compound", "Compound")
+        self.compound.Links = solids
+        self.document.recompute()
+
+        self.page = createPageWithSVGTemplate()
+
+        self.prefs = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        self.parallelHlrSolids = self.prefs.GetBool("ParallelHlrSolids", False)
+        self.hlrCacheSize = self.prefs.GetInt("HlrCacheSize", 200)
+        # the second projection must not be served from the cache
+        self.prefs.SetInt("HlrCacheSize", 0)
+        print("DrawViewPartHlr test: page created")
+
+    def tearDown(self):
+        self.prefs.SetBool("ParallelHlrSolids", self.parallelHlrSolids)
+        self.prefs.SetInt("HlrCacheSize", self.hlrCacheSize)
+        print("DrawViewPartHlr test: finished")
+        FreeCAD.closeDocument("TDHlr")
+
+    def makeView(self, direction):
+        view = self.document.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        view.Source = [self.compound]
+        view.Direction = direction
+        return view
+
+    def testParallelSolids(self):
+        """Tests if projecting the solids of a compound in parallel gives the same edges"""
+        view = self.makeView(FreeCAD.Vector(1.0, -1.0, 1.0))
+
+        self.prefs.SetBool("ParallelHlrSolids", False)
+        view.touch()
+        self.document.recompute()
+        visible = edgeSignature(view.getVisibleEdges())
+        hidden = edgeSignature(view.getHiddenEdges())
+        self.assertTrue(visible, "DrawViewPart has no visible edges")
+        self.assertTrue(hidden, "DrawViewPart has no hidden edges")
+
+        self.prefs.SetBool("ParallelHlrSolids", True)
+        view.touch()
+        self.document.recompute()
+        self.assertEqual(len(view.getVisibleEdges()), len(visible))
+        self.assertEqual(len(view.getHiddenEdges()), len(hidden))
+        self.assertEqual(edgeSignature(view.getVisibleEdges()), visible)
+        self.assertEqual(edgeSignature(view.getHiddenEdges()), hidden)
+        self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
+
+    def testConsoleRecomputeOfPage(self):
+        """Tests if the views of a page get their geometry from a recompute in console mode,
+        without waiting for the HLR threads"""
+        views = [
+            self.makeView(FreeCAD.Vector(0.0, -1.0, 0.0)),
+            self.makeView(FreeCAD.Vector(0.0, 0.0, 1.0)),
+            self.makeView(FreeCAD.Vector(1.0, -1.0, 1.0)),
+        ]
+        self.document.recompute()
+
+        for view in views:
+            self.assertTrue(view.getVisibleEdges(), view.Name + " has no visible edges")
+            self.assertTrue("Up-to-date" in view.State, view.Name + " is not Up-to-date")
+
+    def testConsoleRecomputeOfProjectionGroup(self):
+        """Tests if the items of a projection group get their geometry from a recompute in
+        console mode, without waiting for the HLR threads"""
+        group = self.document.addObject("TechDraw::DrawProjGroup", "ProjGroup")
+        self.page.addView(group)
+        group.Source = [self.compound]
+        group.addProjection("Front")
+        group.Anchor.Direction = FreeCAD.Vector(0.0, -1.0, 0.0)
+        group.Anchor.RotationVector = FreeCAD.Vector(1.0, 0.0, 0.0)
+        for projection in ["Top", "Right", "FrontTopRight"]:
+            group.addProjection(projection)
+        self.document.recompute()
+
+        self.assertEqual(len(group.Views), 4)
+        for item in group.Views:
+            self.assertTrue(item.getVisibleEdges(), item.Label + " has no visible edges")
+            self.assertTrue("Up-to-date" in item.State, item.Label + " is not Up-to-date")
+        self.assertTrue("Up-to-date" in group.State, "DrawProjGroup is not Up-to-date")
+
+
+if __name__ == "__main__":
+    unittest.main()
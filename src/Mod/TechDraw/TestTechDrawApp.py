@@ -27,4 +27,6 @@ from TDTest.DrawViewBalloonTest import DrawViewBalloonTest  # noqa: F401
 from TDTest.DrawViewImageTest import DrawViewImageTest  # noqa: F401
 from TDTest.DrawViewSymbolTest import DrawViewSymbolTest  # noqa: F401
 from TDTest.DrawProjectionGroupTest import DrawProjectionGroupTest  # noqa: F401
+from TDTest.DrawViewPartHlrTest import DrawViewPartHlrTest  # noqa: F401
+from TDTest.DrawViewPartCacheTest import DrawViewPartCacheTest  # noqa: F401
 
@@ -80,8 +80,9 @@ class PerfTestCase(unittest.TestCase):
             # This is Python 3.12 on supported platforms ( linux ) only so that if we are run under
             # an external 'perf' command, we report the python data.  This can be extremely useful,
             # because it contains not only time consumed, but python and c++ calls that took place
-            # so deep analysis can be performed on the resulting file.  See calling script in
-            # tools/profile/perftest.sh for a wrapper.
+            # so deep analysis can be performed on the resulting file, e.g. when run as
+            # "perf record FreeCAD -t TestPerf --pass <modelname>".  For timing the document
+            # core phase by phase see tools/profile/benchmark.py instead.
             sys.activate_stack_trampoline("perf")
         except AttributeError:
             pass  # Totally okay if we don't have that, we can use the cProfile if it's there.
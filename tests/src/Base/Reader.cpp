@@ -7,12 +7,18 @@
 #endif
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Writer.h"
 #include <array>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <memory>
 #include <random>
 #include <string>
+#include <thread>
+#include <vector>
 #include <xercesc/util/PlatformUtils.hpp>
 
 namespace fs = std::filesystem;
@@ -387,3 +393,106 @@ TEST_F(ReaderTest, invalidDefaults)
         { xml.Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+class RestorePayload: public Base::Persistence
+{
+public:
+    RestorePayload(std::string data, bool concurrent, std::vector<std::string>& finished)
+        : data(std::move(data))
+        , concurrent(concurrent)
+        , finished(finished)
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        restored.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
+        restoreThread = std::this_thread::get_id();
+        finished.push_back(restored);
+    }
+    bool canRestoreDocFileConcurrently() const override
+    {
+        return concurrent;
+    }
+    void readDocFile(Base::Reader& reader) override
+    {
+        pending.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
+    }
+    void finishRestoreDocFile() override
+    {
+        restored = std::move(pending);
+        restoreThread = std::this_thread::get_id();
+        finished.push_back(restored);
+    }
+
+    std::string data;
+    std::string restored;
+    std::thread::id restoreThread;
+
+private:
+    bool concurrent;
+    std::string pending;
+    std::vector<std::string>& finished;
+};
+
+TEST_F(ReaderTest, readFilesParallel)
+{
+    // Arrange
+    std::vector<std::string> finished;
+    std::vector<std::unique_ptr<RestorePayload>> payloads;
+    for (int i = 0; i < 12; ++i) {
+        std::string data(5000 * (i + 1), static_cast<char>('a' + i));
+        data += std::to_string(i);
+        // every third file is restored the sequential way
+        payloads.push_back(std::make_unique<RestorePayload>(data, i % 3 != 0, finished));
+    }
+    fs::path zipFile =
+        fs::temp_directory_path() / ("unit_test_Reader-" + random_string(4) + ".zip");
+    {
+        Base::ZipWriter writer(zipFile.string().c_str());
+        writer.setThreads(4);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<document/>";
+        for (std::size_t i = 0; i < payloads.size(); ++i) {
+            writer.addFile(("Payload" + std::to_string(i) + ".bin").c_str(),
+                           payloads[i].get());
+        }
+        writer.writeFiles();
+    }
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream("");
+    for (std::size_t i = 0; i < payloads.size(); ++i) {
+        xml.Reader()->addFile(("Payload" + std::to_string(i) + ".bin").c_str(),
+                              payloads[i].get());
+    }
+    // a registered file that is missing in the archive is skipped
+    RestorePayload missing("", true, finished);
+    xml.Reader()->addFile("Missing.bin", &missing);
+
+    // Act
+    xml.Reader()->readFiles(zipFile.string(), 4);
+    fs::remove(zipFile);
+
+    // Assert
+    ASSERT_EQ(finished.size(), payloads.size());
+    for (std::size_t i = 0; i < payloads.size(); ++i) {
+        EXPECT_EQ(payloads[i]->restored, payloads[i]->data);
+        // the results are applied on the calling thread in the order of registration
+        EXPECT_EQ(payloads[i]->restoreThread, std::this_thread::get_id());
+        EXPECT_EQ(finished[i], payloads[i]->data);
+    }
+    EXPECT_TRUE(missing.restored.empty());
+    EXPECT_FALSE(xml.Reader()->hasReadFailed("Payload0.bin"));
+    EXPECT_FALSE(xml.Reader()->hasReadFailed("Payload1.bin"));
+}
@@ -2,7 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <sstream>
+#include <zipios++/zipinputstream.h>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +134,104 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+class ZipPayload: public Base::Persistence
+{
+public:
+    explicit ZipPayload(std::string data)
+        : data(std::move(data))
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+
+private:
+    std::string data;
+};
+
+TEST(ZipWriterTest, writeFilesParallel)
+{
+    // Arrange
+    std::vector<std::unique_ptr<ZipPayload>> payloads;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 10; ++i) {
+        std::string data(10000 * (i + 1), static_cast<char>('a' + i));
+        data += std::to_string(i);
+        expected.push_back(data);
+        payloads.push_back(std::make_unique<ZipPayload>(data));
+    }
+    std::stringstream archive;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setThreads(4);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (const auto& payload : payloads) {
+            writer.addFile("Payload.bin", payload.get());
+        }
+        writer.writeFiles();
+    }
+
+    // Assert
+    archive.seekg(0);
+    zipios::ZipInputStream zipstream(archive);
+    std::stringstream document;
+    document << zipstream.rdbuf();
+    EXPECT_EQ(document.str(), "<Document/>");
+    for (const auto& data : expected) {
+        auto entry = zipstream.getNextEntry();
+        ASSERT_TRUE(entry->isValid());
+        std::stringstream content;
+        content << zipstream.rdbuf();
+        EXPECT_EQ(content.str(), data);
+    }
+}
+
+TEST(ZipWriterTest, writeUncompressedFiles)
+{
+    for (int threads : {1, 4}) {
+        // Arrange
+        ZipPayload compressed(std::string(10000, 'a'));
+        ZipPayload stored(std::string(10000, 'b'));
+        std::stringstream archive;
+
+        // Act
+        {
+            Base::ZipWriter writer(archive);
+            writer.setThreads(threads);
+            writer.putNextEntry("Document.xml");
+            writer.Stream() << "<Document/>";
+            writer.addFile("Compressed.bin", &compressed);
+            writer.addFile("Stored.bin", &stored, false);
+            writer.addFile("Compressed.bin", &compressed);
+            writer.writeFiles();
+        }
+
+        // Assert
+        archive.seekg(0);
+        zipios::ZipInputStream zipstream(archive);
+        std::stringstream document;
+        document << zipstream.rdbuf();
+        EXPECT_EQ(document.str(), "<Document/>");
+        for (auto method : {zipios::DEFLATED, zipios::STORED, zipios::DEFLATED}) {
+            auto entry = zipstream.getNextEntry();
+            ASSERT_TRUE(entry->isValid());
+            EXPECT_EQ(entry->getMethod(), method);
+            std::stringstream content;
+            content << zipstream.rdbuf();
+            EXPECT_EQ(content.str(),
+                      std::string(10000, method == zipios::STORED ? 'b' : 'a'));
+        }
+    }
+}
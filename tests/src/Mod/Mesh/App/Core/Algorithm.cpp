@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <set>
+
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshPointAdjacencyTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a fan of six triangles around the point 0
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(0.F, 0.F, 0.F)));
+        for (int i = 0; i < 6; i++) {
+            float angle = float(i) * 1.0471976F;
+            points.push_back(
+                MeshCore::MeshPoint(Base::Vector3f(std::cos(angle), std::sin(angle), 0.F)));
+        }
+        for (int i = 0; i < 6; i++) {
+            facets.push_back(MeshCore::MeshFacet(0, i + 1, (i + 1) % 6 + 1));
+        }
+        kernel.Adopt(points, facets, true);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshPointAdjacencyTest, TestSameAsRefPointToPoints)
+{
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    MeshCore::MeshRefPointToPoints vv_it(kernel);
+    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        auto points = adjacency.GetPoints(i);
+        auto facets = adjacency.GetFacets(i);
+        EXPECT_EQ(std::set<MeshCore::PointIndex>(points.begin(), points.end()), vv_it[i]);
+        EXPECT_EQ(std::set<MeshCore::FacetIndex>(facets.begin(), facets.end()), vf_it[i]);
+    }
+}
+
+TEST_F(MeshPointAdjacencyTest, TestRows)
+{
+    MeshCore::MeshPointAdjacency adjacency(kernel);
+    EXPECT_EQ(adjacency.GetPoints(0).size(), 6);
+    EXPECT_EQ(adjacency.GetFacets(0).size(), 6);
+    EXPECT_EQ(adjacency.GetPoints(1).size(), 3);
+    EXPECT_EQ(adjacency.GetFacets(1).size(), 2);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshFacetBVHTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a row of unit triangles where every triangle overlaps with its successor
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (int i = 0; i < 50; i++) {
+            float x = 0.5F * float(i);
+            points.push_back(MeshCore::MeshPoint(Base::Vector3f(x, 0.F, 0.F)));
+            points.push_back(MeshCore::MeshPoint(Base::Vector3f(x + 0.9F, 0.F, 0.F)));
+            points.push_back(MeshCore::MeshPoint(Base::Vector3f(x, 1.F, float(i % 2))));
+            facets.push_back(MeshCore::MeshFacet(3 * i, 3 * i + 1, 3 * i + 2));
+        }
+        kernel.Adopt(points, facets, true);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshFacetBVHTest, TestInside)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_EQ(bvh.GetBoundBox().MaxX, kernel.GetBoundBox().MaxX);
+
+    std::vector<MeshCore::FacetIndex> facets;
+    bvh.Inside(Base::BoundBox3f(10.2F, 0.F, 0.F, 10.3F, 1.F, 1.F), facets);
+    std::sort(facets.begin(), facets.end());
+    EXPECT_EQ(facets, std::vector<MeshCore::FacetIndex>({19, 20}));
+}
+
+TEST_F(MeshFacetBVHTest, TestNearestFacet)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    float dist = 0.F;
+    EXPECT_EQ(bvh.NearestFacet(Base::Vector3f(-1.F, 0.F, 0.F), 2.F, dist), 0);
+    EXPECT_FLOAT_EQ(dist, 1.F);
+    EXPECT_EQ(bvh.NearestFacet(Base::Vector3f(26.F, 0.F, 0.F), 2.F, dist), 49);
+    EXPECT_EQ(bvh.NearestFacet(Base::Vector3f(-1.F, 0.F, 0.F), 0.5F, dist),
+              MeshCore::FACET_INDEX_MAX);
+
+    // compare with a linear search
+    Base::Vector3f point(12.1F, 0.3F, 2.F);
+    float minDist = std::numeric_limits<float>::max();
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        minDist = std::min(minDist, kernel.GetFacet(i).DistanceToPoint(point));
+    }
+    ASSERT_NE(bvh.NearestFacet(point, 10.F, dist), MeshCore::FACET_INDEX_MAX);
+    EXPECT_FLOAT_EQ(dist, minDist);
+}
+
+TEST_F(MeshFacetBVHTest, TestCollectPairs)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    std::function<bool(MeshCore::FacetIndex,
+                       MeshCore::FacetIndex,
+                       std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>&)>
+        test = [](MeshCore::FacetIndex index1,
+                  MeshCore::FacetIndex index2,
+                  std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>& result) {
+            result = std::make_pair(index1, index2);
+            return true;
+        };
+
+    auto pairs = bvh.CollectPairs(bvh, test, false, 4, "");
+    std::sort(pairs.begin(), pairs.end());
+    ASSERT_EQ(pairs.size(), 49);
+    for (MeshCore::FacetIndex i = 0; i < 49; i++) {
+        EXPECT_EQ(pairs[i].first, i);
+        EXPECT_EQ(pairs[i].second, i + 1);
+    }
+
+    EXPECT_EQ(bvh.CollectPairs(bvh, test, true, 4, "").size(), 1);
+
+    // the order of the results must not depend on the number of threads
+    EXPECT_EQ(bvh.CollectPairs(bvh, test, false, 1, ""),
+              bvh.CollectPairs(bvh, test, false, 3, ""));
+}
+
+TEST_F(MeshFacetBVHTest, TestCollectPairsOfTwoMeshes)
+{
+    MeshCore::MeshKernel other;
+    MeshCore::MeshPointArray points;
+    points.push_back(MeshCore::MeshPoint(Base::Vector3f(5.1F, -1.F, 0.F)));
+    points.push_back(MeshCore::MeshPoint(Base::Vector3f(5.2F, -1.F, 0.F)));
+    points.push_back(MeshCore::MeshPoint(Base::Vector3f(5.1F, 2.F, 0.F)));
+    MeshCore::MeshFacetArray facets;
+    facets.push_back(MeshCore::MeshFacet(0, 1, 2));
+    other.Adopt(points, facets, true);
+
+    MeshCore::MeshFacetBVH bvh1(kernel);
+    MeshCore::MeshFacetBVH bvh2(other);
+    std::function<bool(MeshCore::FacetIndex, MeshCore::FacetIndex, MeshCore::FacetIndex&)> test =
+        [](MeshCore::FacetIndex index1, MeshCore::FacetIndex index2, MeshCore::FacetIndex& result) {
+            EXPECT_EQ(index2, 0);
+            result = index1;
+            return true;
+        };
+
+    auto found = bvh1.CollectPairs(bvh2, test, false, 2, "");
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, std::vector<MeshCore::FacetIndex>({9, 10}));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshSimplifyTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a planar grid that is big enough to be split into several partitions
+        const int count = 240;
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (int y = 0; y <= count; y++) {
+            for (int x = 0; x <= count; x++) {
+                points.push_back(MeshCore::MeshPoint(Base::Vector3f(float(x), float(y), 0.F)));
+            }
+        }
+        for (int y = 0; y < count; y++) {
+            for (int x = 0; x < count; x++) {
+                MeshCore::PointIndex p0 = y * (count + 1) + x;
+                MeshCore::PointIndex p1 = p0 + 1;
+                MeshCore::PointIndex p2 = p0 + count + 1;
+                MeshCore::PointIndex p3 = p2 + 1;
+                facets.push_back(MeshCore::MeshFacet(p0, p1, p3));
+                facets.push_back(MeshCore::MeshFacet(p0, p3, p2));
+            }
+        }
+        kernel.Adopt(points, facets, true);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshSimplifyTest, TestParallel)
+{
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.simplifyParallel(10000, 0.01F);
+
+    EXPECT_LT(kernel.CountFacets(), 20000);
+    EXPECT_FLOAT_EQ(kernel.GetBoundBox().LengthX(), 240.F);
+    EXPECT_FLOAT_EQ(kernel.GetBoundBox().LengthY(), 240.F);
+    EXPECT_FLOAT_EQ(kernel.GetBoundBox().LengthZ(), 0.F);
+
+    MeshCore::MeshEvalTopology topology(kernel);
+    EXPECT_TRUE(topology.Evaluate());
+}
+
+TEST_F(MeshSimplifyTest, TestParallelKeepsSmallMesh)
+{
+    std::size_t count = kernel.CountFacets();
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.simplifyParallel(int(count), 0.F);
+
+    EXPECT_EQ(kernel.CountFacets(), count);
+}
+
+TEST(MeshSimplifyCurvedTest, TestParallelErrorBound)
+{
+    // a grid on a spherical cap, so that every collapse moves the surface
+    const int count = 240;
+    const float radius = 240.F;
+    const Base::Vector3f center(120.F, 120.F, 0.F);
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    for (int y = 0; y <= count; y++) {
+        for (int x = 0; x <= count; x++) {
+            float dx = float(x) - center.x;
+            float dy = float(y) - center.y;
+            float z = std::sqrt(radius * radius - dx * dx - dy * dy);
+            points.push_back(MeshCore::MeshPoint(Base::Vector3f(float(x), float(y), z)));
+        }
+    }
+    for (int y = 0; y < count; y++) {
+        for (int x = 0; x < count; x++) {
+            MeshCore::PointIndex p0 = y * (count + 1) + x;
+            MeshCore::PointIndex p1 = p0 + 1;
+            MeshCore::PointIndex p2 = p0 + count + 1;
+            MeshCore::PointIndex p3 = p2 + 1;
+            facets.push_back(MeshCore::MeshFacet(p0, p1, p3));
+            facets.push_back(MeshCore::MeshFacet(p0, p3, p2));
+        }
+    }
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    std::size_t numFacets = kernel.CountFacets();
+
+    const float maxError = 0.01F;
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.simplifyParallel(1000, maxError);
+
+    // the bound stops the decimation before the target is reached
+    EXPECT_LT(kernel.CountFacets(), numFacets / 2);
+    EXPECT_GT(kernel.CountFacets(), 1000);
+    for (const auto& point : kernel.GetPoints()) {
+        EXPECT_LE(std::fabs(Base::Distance(point, center) - radius), maxError);
+    }
+
+    MeshCore::MeshEvalTopology topology(kernel);
+    EXPECT_TRUE(topology.Evaluate());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshEvaluationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a strip of two triangles with a third and fourth one attached to the inner edge
+        MeshCore::MeshPointArray points;
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(0.F, 0.F, 0.F)));
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(1.F, 0.F, 0.F)));
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(1.F, 1.F, 0.F)));
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(0.F, 1.F, 0.F)));
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(0.F, 0.F, 1.F)));
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(1.F, 1.F, 1.F)));
+
+        MeshCore::MeshFacetArray facets;
+        facets.push_back(MeshCore::MeshFacet(0, 1, 2));
+        facets.push_back(MeshCore::MeshFacet(0, 2, 3));
+        kernel.Adopt(points, facets, true);
+    }
+
+    void AddNonManifolds()
+    {
+        MeshCore::MeshFacetArray facets = kernel.GetFacets();
+        MeshCore::MeshPointArray points = kernel.GetPoints();
+        facets.push_back(MeshCore::MeshFacet(2, 0, 4));
+        facets.push_back(MeshCore::MeshFacet(0, 2, 5));
+        kernel.Adopt(points, facets, true);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshEvaluationTest, TestRebuildNeighbours)
+{
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    EXPECT_EQ(facets[0]._aulNeighbours[0], MeshCore::FACET_INDEX_MAX);
+    EXPECT_EQ(facets[0]._aulNeighbours[1], MeshCore::FACET_INDEX_MAX);
+    EXPECT_EQ(facets[0]._aulNeighbours[2], 1);
+    EXPECT_EQ(facets[1]._aulNeighbours[0], 0);
+    EXPECT_EQ(facets[1]._aulNeighbours[1], MeshCore::FACET_INDEX_MAX);
+    EXPECT_EQ(facets[1]._aulNeighbours[2], MeshCore::FACET_INDEX_MAX);
+
+    MeshCore::MeshEvalNeighbourhood eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+    EXPECT_TRUE(eval.GetIndices().empty());
+}
+
+TEST_F(MeshEvaluationTest, TestInvalidNeighbours)
+{
+    MeshCore::MeshFacetArray facets = kernel.GetFacets();
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    facets[1]._aulNeighbours[1] = 0;
+    kernel.Adopt(points, facets, false);
+
+    MeshCore::MeshEvalNeighbourhood eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+    EXPECT_EQ(eval.GetIndices(), std::vector<MeshCore::FacetIndex>({1}));
+
+    kernel.RebuildNeighbours();
+    EXPECT_TRUE(eval.Evaluate());
+}
+
+TEST_F(MeshEvaluationTest, TestNonManifolds)
+{
+    MeshCore::MeshEvalTopology eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+
+    AddNonManifolds();
+    EXPECT_FALSE(eval.Evaluate());
+    ASSERT_EQ(eval.CountManifolds(), 1);
+    EXPECT_EQ(eval.GetIndices().front().first, 0);
+    EXPECT_EQ(eval.GetIndices().front().second, 2);
+    EXPECT_EQ(eval.GetFacets().front(), std::vector<MeshCore::FacetIndex>({0, 1, 2, 3}));
+}
+
+TEST_F(MeshEvaluationTest, TestOrientation)
+{
+    MeshCore::MeshEvalOrientation eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+
+    MeshCore::MeshFacetArray facets = kernel.GetFacets();
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    facets[1].FlipNormal();
+    kernel.Adopt(points, facets, true);
+    EXPECT_FALSE(eval.Evaluate());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
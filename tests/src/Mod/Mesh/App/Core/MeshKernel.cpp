@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <Base/Exception.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshKernelTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        facets.emplace_back(Base::Vector3f(0.F, 0.F, 0.F),
+                            Base::Vector3f(1.F, 0.F, 0.F),
+                            Base::Vector3f(0.F, 1.F, 0.F));
+        facets.emplace_back(Base::Vector3f(1.F, 0.F, 0.F),
+                            Base::Vector3f(1.F, 1.F, 0.F),
+                            Base::Vector3f(0.F, 1.F, 0.F));
+        facets.emplace_back(Base::Vector3f(1.F, 0.F, 0.F),
+                            Base::Vector3f(2.F, 0.F, 1.F),
+                            Base::Vector3f(1.F, 1.F, 0.F));
+        kernel.AddFacets(facets);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshKernelTest, TestWriteRead)
+{
+    std::stringstream str;
+    kernel.Write(str);
+
+    MeshCore::MeshKernel copy;
+    copy.Read(str);
+
+    ASSERT_EQ(copy.CountPoints(), kernel.CountPoints());
+    ASSERT_EQ(copy.CountFacets(), kernel.CountFacets());
+    for (unsigned long i = 0; i < kernel.CountPoints(); i++) {
+        EXPECT_EQ(copy.GetPoints()[i], kernel.GetPoints()[i]);
+    }
+    for (unsigned long i = 0; i < kernel.CountFacets(); i++) {
+        const MeshCore::MeshFacet& face1 = kernel.GetFacets()[i];
+        const MeshCore::MeshFacet& face2 = copy.GetFacets()[i];
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(face1._aulPoints[j], face2._aulPoints[j]);
+            EXPECT_EQ(face1._aulNeighbours[j], face2._aulNeighbours[j]);
+        }
+    }
+    EXPECT_EQ(copy.GetBoundBox().MaxX, kernel.GetBoundBox().MaxX);
+}
+
+TEST_F(MeshKernelTest, TestReadTruncated)
+{
+    std::stringstream str;
+    kernel.Write(str);
+    std::string data = str.str();
+    std::stringstream truncated(data.substr(0, data.size() - 60));
+
+    MeshCore::MeshKernel copy;
+    EXPECT_THROW(copy.Read(truncated), Base::BadFormatError);
+    EXPECT_EQ(copy.CountFacets(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -95,4 +95,46 @@ TEST(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST(MeshTest, TestSpatialIndexIsShared)
+{
+    MeshCore::MeshKernel kernel;
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    Base::Vector3f p4 {1, 1, 0};
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+
+    Mesh::MeshObject mesh(kernel);
+    auto grid1 = mesh.getFacetGrid();
+    auto grid2 = mesh.getFacetGrid();
+    EXPECT_EQ(grid1, grid2);
+    EXPECT_FALSE(mesh.hasSelfIntersections());
+    EXPECT_FALSE(mesh.hasSelfIntersections());
+
+    Mesh::MeshObject::SpatialIndexStatistics stats = mesh.getSpatialIndexStatistics();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.rebuilds, 2);
+}
+
+TEST(MeshTest, TestSpatialIndexIsInvalidated)
+{
+    MeshCore::MeshKernel kernel;
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+
+    Mesh::MeshObject mesh(kernel);
+    auto grid1 = mesh.getFacetGrid();
+    mesh.movePoint(0, Base::Vector3d(0, 0, 1));
+    auto grid2 = mesh.getFacetGrid();
+    EXPECT_NE(grid1, grid2);
+
+    Mesh::MeshObject::SpatialIndexStatistics stats = mesh.getSpatialIndexStatistics();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.rebuilds, 2);
+    EXPECT_EQ(stats.version, 1);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -230,3 +230,33 @@ TEST_F(FeaturePartTest, getComplexElementTypes)
     EXPECT_STREQ(types[1], "Edge");
     EXPECT_STREQ(types[2], "Vertex");
 }
+
+TEST_F(FeaturePartTest, parallelRecompute)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("ParallelRecompute", true);
+    hGrp->SetInt("RecomputeThreads", 4);
+    _common->Base.setValue(_boxes[0]);
+    _common->Tool.setValue(_boxes[1]);
+
+    // Act
+    bool hasError = false;
+    int count = _doc->recompute({}, false, &hasError);
+    hGrp->RemoveBool("ParallelRecompute");
+    hGrp->RemoveInt("RecomputeThreads");
+
+    // Assert
+    EXPECT_FALSE(hasError);
+    EXPECT_EQ(count, static_cast<int>(_boxes.size()) + 1);
+    EXPECT_TRUE(_boxes[0]->canRecomputeConcurrently());
+    EXPECT_FALSE(_common->canRecomputeConcurrently());
+    for (auto box : _boxes) {
+        EXPECT_TRUE(box->isValid());
+        EXPECT_FALSE(box->isTouched());
+        EXPECT_FALSE(box->Shape.getShape().isNull());
+    }
+    EXPECT_FALSE(_common->isTouched());
+    EXPECT_DOUBLE_EQ(getVolume(_common->Shape.getShape().getShape()), 3.0);
+}
@@ -6,6 +6,7 @@
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
+#include <Base/Reader.h>
 #include "PartTestHelpers.h"
 #include "Mod/Part/App/TopoShapeCompoundPy.h"
 
@@ -269,3 +270,26 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testLazyRestoreDocFile)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    hGrp->SetBool("LazyLoad", true);
+    hGrp->SetBool("LazyLoadPrefetch", false);
+    std::stringstream str;
+    _boxes[0]->Shape.getShape().exportBrep(str);
+    Base::Reader reader(str, "Box.Shape.brp", 0);
+    Part::PropertyPartShape prop;
+
+    // Act
+    prop.RestoreDocFile(reader);
+    hGrp->RemoveBool("LazyLoad");
+    hGrp->RemoveBool("LazyLoadPrefetch");
+
+    // Assert
+    EXPECT_FALSE(prop.getShape().isNull());
+    EXPECT_DOUBLE_EQ(getVolume(prop.getValue()), 6.0);
+    EXPECT_EQ(prop.getShape().getSubTopoShapes(TopAbs_FACE).size(), 6);
+}
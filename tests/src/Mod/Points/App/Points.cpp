@@ -238,4 +238,65 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestASCIIWithStride)
+{
+    std::string name = getFileName() + ".asc";
+    Points::AscWriter writer(getKernel());
+    writer.write(name);
+
+    Points::AscReader reader;
+    reader.setStride(3);
+    reader.read(name);
+
+    EXPECT_TRUE(reader.isSubsampled());
+    EXPECT_EQ(reader.getWidth(), 3);
+    EXPECT_EQ(reader.getHeight(), 1);
+    EXPECT_EQ(reader.getPoints().getBasicPoints()[1], Base::Vector3f(0, 1, 1));
+}
+
+TEST_F(PointsTest, TestPLYWithStride)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setColors(getColors());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.setStride(2);
+    reader.read(name);
+
+    EXPECT_EQ(reader.getWidth(), 4);
+    EXPECT_EQ(reader.getHeight(), 1);
+    EXPECT_EQ(reader.getIntensities().size(), 4);
+    EXPECT_EQ(reader.getColors().size(), 4);
+    EXPECT_EQ(reader.getNormals().size(), 4);
+    EXPECT_FLOAT_EQ(reader.getIntensities()[1], 0.3F);
+    EXPECT_EQ(reader.getPoints().getBasicPoints()[3], Base::Vector3f(1, 1, 0));
+}
+
+TEST_F(PointsTest, TestPCDStructuredWithVoxelSize)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setWidth(4);
+    writer.setHeight(2);
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.setVoxelSize(0.5);
+    reader.read(name);
+    EXPECT_FALSE(reader.isStructured());
+    EXPECT_EQ(reader.getWidth(), 8);
+    EXPECT_EQ(reader.getHeight(), 1);
+
+    reader.setVoxelSize(2.0);
+    reader.read(name);
+    EXPECT_FALSE(reader.isStructured());
+    EXPECT_EQ(reader.getWidth(), 1);
+    EXPECT_EQ(reader.getIntensities().size(), 1);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
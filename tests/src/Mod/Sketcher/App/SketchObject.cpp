@@ -860,3 +860,33 @@ TEST_F(SketchObjectTest, testGetElementName)
     EXPECT_STREQ(reverse_export_name.newName.c_str(), (";" + tagName + "v1;SKT.Vertex1").c_str());
     EXPECT_STREQ(reverse_export_name.oldName.c_str(), "Vertex1");
 }
+
+TEST_F(SketchObjectTest, testConsecutiveMoveGeometry)
+{
+    // Arrange
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+    int geoId = getObject()->addGeometry(&lineSeg);
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Distance;
+    constraint->First = geoId;
+    constraint->FirstPos = Sketcher::PointPos::none;
+    constraint->setValue(2.0);
+    getObject()->addConstraint(std::move(constraint));
+    getObject()->solve();
+
+    // Act
+    // Consecutive moves of the same point continue the move set up by the first call
+    int result = 0;
+    Base::Vector3d toPoint;
+    for (int i = 1; i <= 5 && result == 0; ++i) {
+        toPoint = Base::Vector3d(3.0 + 0.2 * i, 4.0, 0.0);
+        result = getObject()->moveGeometry(geoId, Sketcher::PointPos::end, toPoint);
+    }
+
+    // Assert
+    EXPECT_EQ(result, 0);
+    auto line = getObject()->getGeometry<Part::GeomLineSegment>(geoId);
+    EXPECT_NEAR((line->getEndPoint() - toPoint).Length(), 0.0, 1e-6);
+    EXPECT_NEAR((line->getEndPoint() - line->getStartPoint()).Length(), 2.0, 1e-6);
+}
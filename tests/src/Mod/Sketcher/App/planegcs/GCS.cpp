@@ -50,3 +50,96 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveWithSparseJacobian)  // NOLINT
+{
+    // Arrange
+    const double distance {1.5};
+    const std::vector<double> start {0.0, 0.0, 1.0, 0.2, 2.1, 0.1, 2.9, 1.2};
+    std::vector<double> coords(start);
+    std::vector<double> distances(3, distance);
+    std::vector<GCS::Point> points(4);
+    GCS::VEC_pD unknowns;
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i].x = &coords[2 * i];
+        points[i].y = &coords[2 * i + 1];
+        // the first point is fixed
+        if (i > 0) {
+            unknowns.push_back(points[i].x);
+            unknowns.push_back(points[i].y);
+        }
+    }
+    for (size_t i = 0; i + 1 < points.size(); ++i) {
+        System()->addConstraintP2PDistance(points[i], points[i + 1], &distances[i]);
+    }
+    System()->jacobianStorage = GCS::SparseJacobian;
+
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (auto step : {GCS::FullPivLU, GCS::LeastNormLdlt}) {
+            // Act
+            coords = start;
+            System()->dogLegGaussStep = step;
+            System()->declareUnknowns(unknowns);
+            System()->initSolution(alg);
+            int result = System()->solve(true, alg);
+            System()->applySolution();
+
+            // Assert
+            EXPECT_EQ(result, GCS::Success);
+            for (size_t i = 0; i + 1 < points.size(); ++i) {
+                EXPECT_NEAR(std::hypot(*points[i + 1].x - *points[i].x,
+                                       *points[i + 1].y - *points[i].y),
+                            distance,
+                            1e-6);
+            }
+        }
+    }
+}
+
+TEST_F(GCSTest, solveIndependentSubsystemsConcurrently)  // NOLINT
+{
+    // Arrange: four chains of two segments, each chain is an independent subsystem
+    const double distance {2.0};
+    const size_t numChains {4};
+    std::vector<double> start;
+    for (size_t i = 0; i < numChains; ++i) {
+        double offset = 10.0 * static_cast<double>(i);
+        start.insert(start.end(), {offset, 0.0, offset + 1.0, 0.3, offset + 2.5, -0.4});
+    }
+    std::vector<double> coords(start);
+    std::vector<double> distances(2 * numChains, distance);
+    std::vector<GCS::Point> points(3 * numChains);
+    GCS::VEC_pD unknowns;
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i].x = &coords[2 * i];
+        points[i].y = &coords[2 * i + 1];
+        // the first point of each chain is fixed
+        if (i % 3 != 0) {
+            unknowns.push_back(points[i].x);
+            unknowns.push_back(points[i].y);
+        }
+    }
+    for (size_t i = 0; i < numChains; ++i) {
+        System()->addConstraintP2PDistance(points[3 * i], points[3 * i + 1], &distances[2 * i]);
+        System()->addConstraintP2PDistance(points[3 * i + 1],
+                                           points[3 * i + 2],
+                                           &distances[2 * i + 1]);
+    }
+    System()->declareUnknowns(unknowns);
+    System()->initSolution();
+    System()->solveThreads = 1;
+    int serialResult = System()->solve();
+    System()->applySolution();
+    std::vector<double> serialCoords(coords);
+    coords = start;
+
+    // Act
+    System()->solveThreads = static_cast<int>(numChains);
+    int result = System()->solve();
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(serialResult, GCS::Success);
+    EXPECT_EQ(result, GCS::Success);
+    EXPECT_EQ(coords, serialCoords);
+}
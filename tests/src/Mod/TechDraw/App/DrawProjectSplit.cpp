@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+#include <Mod/TechDraw/App/DrawProjectSplit.h>
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Edge.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Circ.hxx>
+#include <gp_Pnt.hxx>
+
+#include <numbers>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace TechDraw;
+
+class DrawProjectSplitTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    static TopoDS_Edge makeLine(double x1, double y1, double x2, double y2)
+    {
+        return BRepBuilderAPI_MakeEdge(gp_Pnt(x1, y1, 0.0), gp_Pnt(x2, y2, 0.0)).Edge();
+    }
+
+    //! a grid of lines whose end points lie on, or coincide with, other lines, an arc ending on
+    //! a line, and a field of short disjoint segments that only the box index sorts out
+    static std::vector<TopoDS_Edge> makeFixture()
+    {
+        std::vector<TopoDS_Edge> edges;
+        for (int row = 0; row <= 4; row++) {
+            edges.push_back(makeLine(0.0, 10.0 * row, 40.0, 10.0 * row));
+        }
+        for (int column = 0; column < 4; column++) {
+            edges.push_back(makeLine(5.0 + 10.0 * column, 0.0, 5.0 + 10.0 * column, 40.0));
+        }
+        //end points shared with the ends of the rows, which don't split them
+        edges.push_back(makeLine(0.0, 0.0, 0.0, 40.0));
+        //a stub starting on a row and a line crossing the grid without touching any end point
+        edges.push_back(makeLine(12.0, 10.0, 12.0, 15.0));
+        edges.push_back(makeLine(-5.0, 2.0, 45.0, 37.0));
+        //an arc from (30, 20) to (10, 20) over the middle row
+        gp_Circ circle(gp_Ax2(gp_Pnt(20.0, 20.0, 0.0), gp_Dir(0.0, 0.0, 1.0)), 10.0);
+        edges.push_back(BRepBuilderAPI_MakeEdge(circle, 0.0, std::numbers::pi).Edge());
+
+        for (int iSegment = 0; iSegment < 200; iSegment++) {
+            double x = 100.0 + 3.0 * (iSegment % 20);
+            double y = 3.0 * (iSegment / 20);
+            edges.push_back(makeLine(x, y, x + 1.0, y + 1.0));
+        }
+        return edges;
+    }
+
+    //! the sequential check of all pairs of edges that findSplitPoints replaces
+    static std::vector<splitPoint> findSplitPointsBruteForce(const std::vector<TopoDS_Edge>& edges)
+    {
+        std::vector<splitPoint> splits;
+        for (size_t iOuter = 0; iOuter < edges.size(); iOuter++) {
+            TopoDS_Vertex v1 = TopExp::FirstVertex(edges[iOuter]);
+            TopoDS_Vertex v2 = TopExp::LastVertex(edges[iOuter]);
+            for (size_t iInner = 0; iInner < edges.size(); iInner++) {
+                if (iInner == iOuter) {
+                    continue;
+                }
+                for (const auto& vert : {v1, v2}) {
+                    double param = -1;
+                    if (DrawProjectSplit::isOnEdge(edges[iInner], vert, param, false)) {
+                        gp_Pnt pnt = BRep_Tool::Pnt(vert);
+                        splitPoint s;
+                        s.i = int(iInner);
+                        s.v = Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z());
+                        s.param = param;
+                        splits.push_back(s);
+                    }
+                }
+            }
+        }
+        return splits;
+    }
+};
+
+TEST_F(DrawProjectSplitTest, findSplitPointsMatchesBruteForce)
+{
+    // Arrange
+    std::vector<TopoDS_Edge> edges = makeFixture();
+
+    // Act
+    std::vector<splitPoint> expected = findSplitPointsBruteForce(edges);
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(edges);
+
+    // Assert
+    // the 4 columns end on the outer rows, the stub and the arc on inner rows and 3 rows on
+    // the left border
+    EXPECT_EQ(expected.size(), 14U);
+    ASSERT_EQ(splits.size(), expected.size());
+    for (size_t iSplit = 0; iSplit < splits.size(); iSplit++) {
+        EXPECT_EQ(splits[iSplit].i, expected[iSplit].i);
+        EXPECT_EQ(splits[iSplit].v, expected[iSplit].v);
+        EXPECT_DOUBLE_EQ(splits[iSplit].param, expected[iSplit].param);
+    }
+}
+
+TEST_F(DrawProjectSplitTest, findSplitPointsNoEdges)
+{
+    // Arrange
+    std::vector<TopoDS_Edge> edges;
+
+    // Act
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(edges);
+
+    // Assert
+    EXPECT_TRUE(splits.empty());
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,274 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# ***************************************************************************
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+"""
+Headless benchmark of the document core.
+
+Every document of the corpus is opened and the following phases are timed separately:
+
+    load            App.openDocument()
+    recompute       full recompute after touching every object
+    touch           recompute after touching a single feature that others depend on
+    save            Document.saveCopy() into a temporary directory
+    tessellation    Shape.tessellate() of every Part feature
+
+together with the peak resident set size of the process after each document. This is the
+high-water mark of the whole process, so it never decreases from one document to the next; run
+one document per invocation to get the peak of every document on its own.
+
+Run it with the command line executable and pass the options after "--pass":
+
+    FreeCADCmd tools/profile/benchmark.py --pass [options] [files or directories]
+
+Options:
+
+    --output FILE           write the results as JSON, or as CSV if FILE ends with ".csv"
+    --baseline FILE         compare against a JSON file written by a former run
+    --write-baseline FILE   store the results as a new baseline
+    --tolerance FRACTION    allowed slowdown relative to the baseline (default 0.10)
+    --min-time SECONDS      ignore phases that take less than this in the baseline (default 0.01)
+    --repeat N              run every document N times and keep the median (default 1)
+    --deflection VALUE      linear deflection used for the tessellation (default 0.1)
+
+Without files the documents of data/examples and data/tests are used. The exit code is 1
+if any phase is slower than the baseline allows, 0 otherwise.
+"""
+
+import csv
+import glob
+import json
+import os
+import platform
+import statistics
+import sys
+import tempfile
+import time
+
+import FreeCAD as App
+
+try:
+    import resource
+except ImportError:
+    resource = None
+
+Phases = ("load", "recompute", "touch", "save", "tessellation")
+Suffixes = (".fcstd",)
+
+
+def sourceDir():
+    return os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+
+def defaultCorpus():
+    files = []
+    for subdir in ("examples", "tests"):
+        files += collectFiles(os.path.join(sourceDir(), "data", subdir))
+    return files
+
+
+def collectFiles(path):
+    if os.path.isdir(path):
+        names = glob.glob(os.path.join(path, "*"))
+        return sorted(n for n in names if os.path.splitext(n)[1].lower() in Suffixes)
+    return [path]
+
+
+def peakMemory():
+    """Return the peak resident set size of the process so far in kB or None if unknown"""
+    if resource is None:
+        return None
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # macOS reports bytes, Linux and the BSDs kilobytes
+    if platform.system() == "Darwin":
+        peak //= 1024
+    return peak
+
+
+def timed(func):
+    start = time.perf_counter()
+    func()
+    return time.perf_counter() - start
+
+
+def singleFeature(doc):
+    """Return the object with the most dependent objects, this is what a user typically edits"""
+    candidates = [obj for obj in doc.Objects if obj.InList]
+    if not candidates:
+        return None
+    return max(candidates, key=lambda obj: (len(obj.InListRecursive), obj.Name))
+
+
+def tessellate(doc, deflection):
+    for obj in doc.Objects:
+        shape = getattr(obj, "Shape", None)
+        if shape is not None and not shape.isNull():
+            shape.tessellate(deflection)
+
+
+def runDocument(fileName, tmpDir, deflection):
+    result = {}
+    docs = []
+    result["load"] = timed(lambda: docs.append(App.openDocument(fileName)))
+    doc = docs[0]
+    try:
+        for obj in doc.Objects:
+            obj.touch()
+        result["recompute"] = timed(doc.recompute)
+
+        feature = singleFeature(doc)
+        if feature is not None:
+            feature.touch()
+            result["touch"] = timed(doc.recompute)
+        else:
+            result["touch"] = 0.0
+
+        copy = os.path.join(tmpDir, os.path.basename(fileName))
+        result["save"] = timed(lambda: doc.saveCopy(copy))
+        os.remove(copy)
+
+        result["tessellation"] = timed(lambda: tessellate(doc, deflection))
+    finally:
+        App.closeDocument(doc.Name)
+
+    result["process_peak_rss_kb"] = peakMemory()
+    return result
+
+
+def runCorpus(files, repeat, deflection):
+    results = {}
+    with tempfile.TemporaryDirectory() as tmpDir:
+        for fileName in files:
+            App.Console.PrintMessage("Benchmarking {}\n".format(fileName))
+            runs = [runDocument(fileName, tmpDir, deflection) for _ in range(repeat)]
+            entry = {phase: statistics.median(run[phase] for run in runs) for phase in Phases}
+            entry["process_peak_rss_kb"] = runs[-1]["process_peak_rss_kb"]
+            results[os.path.relpath(fileName, sourceDir())] = entry
+    return results
+
+
+def writeJson(fileName, results):
+    data = {
+        "version": App.Version()[0:3],
+        "platform": platform.platform(),
+        "documents": results,
+    }
+    with open(fileName, "w", encoding="utf-8") as output:
+        json.dump(data, output, indent=2, sort_keys=True)
+
+
+def writeCsv(fileName, results):
+    with open(fileName, "w", encoding="utf-8", newline="") as output:
+        writer = csv.writer(output)
+        writer.writerow(("document",) + Phases + ("process_peak_rss_kb",))
+        for name, entry in sorted(results.items()):
+            writer.writerow(
+                [name] + [entry[phase] for phase in Phases] + [entry["process_peak_rss_kb"]]
+            )
+
+
+def compare(results, baselineFile, tolerance, minTime):
+    """Print the phases that got slower than allowed and return their number"""
+    with open(baselineFile, encoding="utf-8") as input:
+        baseline = json.load(input)["documents"]
+
+    regressions = 0
+    for name, entry in sorted(results.items()):
+        reference = baseline.get(name)
+        if reference is None:
+            App.Console.PrintWarning("{}: not in baseline\n".format(name))
+            continue
+        for phase in Phases:
+            old = reference.get(phase)
+            new = entry[phase]
+            if old is None or old < minTime:
+                continue
+            ratio = new / old
+            if ratio > 1.0 + tolerance:
+                regressions += 1
+                App.Console.PrintError(
+                    "{}: {} {:.3f}s -> {:.3f}s (+{:.0%})\n".format(name, phase, old, new, ratio - 1)
+                )
+    return regressions
+
+
+def parseArguments(argv):
+    options = {
+        "output": None,
+        "baseline": None,
+        "write-baseline": None,
+        "tolerance": 0.10,
+        "min-time": 0.01,
+        "repeat": 1,
+        "deflection": 0.1,
+    }
+    types = {"tolerance": float, "min-time": float, "repeat": int, "deflection": float}
+    files = []
+    args = iter(argv)
+    for arg in args:
+        if arg.startswith("--"):
+            key = arg[2:]
+            if key not in options:
+                raise ValueError("Unknown option {}".format(arg))
+            options[key] = types.get(key, str)(next(args))
+        else:
+            files += collectFiles(arg)
+    return options, files
+
+
+def main():
+    if "--pass" in sys.argv:
+        argv = sys.argv[sys.argv.index("--pass") + 1 :]
+    else:
+        argv = []
+    options, files = parseArguments(argv)
+    if not files:
+        files = defaultCorpus()
+
+    results = runCorpus(files, max(1, options["repeat"]), options["deflection"])
+
+    for name, entry in sorted(results.items()):
+        App.Console.PrintMessage(
+            "{}: ".format(name)
+            + ", ".join("{} {:.3f}s".format(phase, entry[phase]) for phase in Phases)
+            + ", process peak RSS so far {} kB\n".format(entry["process_peak_rss_kb"])
+        )
+
+    output = options["output"]
+    if output:
+        if output.lower().endswith(".csv"):
+            writeCsv(output, results)
+        else:
+            writeJson(output, results)
+    if options["write-baseline"]:
+        writeJson(options["write-baseline"], results)
+
+    if options["baseline"]:
+        regressions = compare(
+            results, options["baseline"], options["tolerance"], options["min-time"]
+        )
+        if regressions:
+            App.Console.PrintError("{} performance regression(s) found\n".format(regressions))
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())